@@ -0,0 +1,646 @@
+/**
+ * \file
+ * Defines the SSXMLBenchmark class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include <QtTest>
+#include "libssqt.h"
+#include "ssqtbnch.hpp"
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static QByteArray __bench_generate(int shape, qint64 size);/*{{{*/
+/**
+ * Generates a document.
+ * @param shape One of the \c SSBENCH_WIDE, \c SSBENCH_DEEP, \c
+ * SSBENCH_ATTRIBUTES or \c SSBENCH_TEXT values.
+ * @param size Approximated size of the document, in bytes.
+ * @returns The document, in UTF-8.
+ **/
+static QByteArray __bench_generate(int shape, qint64 size);
+/*}}}*/
+// static qint64 __bench_limit();/*{{{*/
+/**
+ * Gets the size limit of the generated documents.
+ * @returns The value of the \c SSQT_BENCH_MAX environment variable or \c
+ * SSBENCH_DEFAULT_MAX when it is not set.
+ **/
+static qint64 __bench_limit();
+/*}}}*/
+// static void __bench_collect(const SSXMLElement *root, QList<const SSXMLElement*> *list);/*{{{*/
+/**
+ * Lists all elements of a tree.
+ * @param root The root of the tree.
+ * @param list Receives \a root and all its descendants.
+ **/
+static void __bench_collect(const SSXMLElement *root, QList<const SSXMLElement*> *list);
+/*}}}*/
+// static QString __bench_dump(const SSXMLCompactDocument &document);/*{{{*/
+/**
+ * Describes the content of a compact document.
+ * @param document The document.
+ * @returns One line for each element, in document order, with its name,
+ * number of children, attributes sorted by name and text.
+ **/
+static QString __bench_dump(const SSXMLCompactDocument &document);
+/*}}}*/
+
+/* ===========================================================================
+ * SSXMLBenchmark class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLBenchmark::SSXMLBenchmark();/*{{{*/
+SSXMLBenchmark::SSXMLBenchmark() : m_limit(SSBENCH_DEFAULT_MAX), m_shape(-1), m_size(0)
+{
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Test Case */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLBenchmark::initTestCase();/*{{{*/
+void SSXMLBenchmark::initTestCase()
+{
+    QVERIFY(m_folder.isValid());
+    m_limit = __bench_limit();
+}
+/*}}}*/
+// void SSXMLBenchmark::cleanupTestCase();/*{{{*/
+void SSXMLBenchmark::cleanupTestCase()
+{
+    if (!m_resource.isEmpty())
+        QResource::unregisterResource(m_folder.path() + "/document.rcc");
+}
+/*}}}*/
+///@} Test Case
+
+/* ------------------------------------------------------------------------ */
+/*! \name Checks */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLBenchmark::lazyParity();/*{{{*/
+void SSXMLBenchmark::lazyParity_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    QTest::newRow("comment in text")  << QByteArray("<r>a<!--c-->b</r>");
+    QTest::newRow("comment at end")   << QByteArray("<r>a<!--c--></r>");
+    QTest::newRow("pi in text")       << QByteArray("<r>a<?p x?>b</r>");
+    QTest::newRow("cdata in text")    << QByteArray("<r>a<![CDATA[<b>]]>c</r>");
+    QTest::newRow("space after")      << QByteArray("<r>a<!--c-->  </r>");
+    QTest::newRow("references")       << QByteArray("<r a=\"x&amp;y&#9;z\">&lt;&#x41;&gt;&quot;</r>");
+    QTest::newRow("line breaks")      << QByteArray("<r a=\"1\r\n2\t3\">x\r\ny\rz</r>");
+    QTest::newRow("text and child")   << QByteArray("<r>t<c k=\"v\">u</c>w</r>");
+    QTest::newRow("unknown entity")   << QByteArray("<r>&foo;</r>");
+    QTest::newRow("unknown in value") << QByteArray("<r a=\"&foo;\"/>");
+    QTest::newRow("invalid char")     << QByteArray("<r>&#1;</r>");
+    QTest::newRow("generated")        << __bench_generate(SSBENCH_TEXT, Q_INT64_C(64) * 1024);
+}
+void SSXMLBenchmark::lazyParity()
+{
+    QFETCH(QByteArray, data);
+
+    SSXMLDocument document;
+    SSXMLCompactDocument lazy, utf16;
+    error_t expected = document.open(data);
+
+    QCOMPARE(lazy.load(data), expected);
+    if (expected != SSNO_ERROR) return;
+
+    QCOMPARE(lazy.storage(), (uint)SSXML_STORE_LAZY);
+    QCOMPARE(utf16.assign(&document, SSXML_STORE_UTF16), (error_t)SSNO_ERROR);
+    QCOMPARE(__bench_dump(lazy), __bench_dump(utf16));
+}
+/*}}}*/
+// void SSXMLBenchmark::gzipRoundTrip();/*{{{*/
+void SSXMLBenchmark::gzipRoundTrip_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    QTest::newRow("wide")       << __bench_generate(SSBENCH_WIDE, Q_INT64_C(64) * 1024);
+    QTest::newRow("deep")       << __bench_generate(SSBENCH_DEEP, Q_INT64_C(64) * 1024);
+    QTest::newRow("attributes") << __bench_generate(SSBENCH_ATTRIBUTES, Q_INT64_C(64) * 1024);
+    QTest::newRow("text")       << __bench_generate(SSBENCH_TEXT, Q_INT64_C(64) * 1024);
+    QTest::newRow("non ascii")  << QByteArray("<r a=\"\xC3\xA7\xC3\xA3o\">\xE2\x82\xAC &amp; \xF0\x9F\x98\x80</r>");
+}
+void SSXMLBenchmark::gzipRoundTrip()
+{
+    QFETCH(QByteArray, data);
+
+    SSXMLDocument document;
+    QCOMPARE(document.open(data), (error_t)SSNO_ERROR);
+
+    /* Through a device, in memory. */
+    QBuffer buffer;
+    SSGZipDevice zip(&buffer);
+
+    QCOMPARE(document.write(&zip, SSENC_UTF8), (error_t)SSNO_ERROR);
+    QVERIFY(SSGZipDevice::isCompressed(buffer.data()));
+
+    SSXMLDocument memory;
+    QCOMPARE(memory.open(buffer.data()), (error_t)SSNO_ERROR);
+    QVERIFY(memory.isEqualTo(&document));
+
+    /* Through a file, selected by its suffix. */
+    QString path = m_folder.path() + "/roundtrip.xml" SSGZIP_SUFFIX;
+    QCOMPARE(document.write(path, SSENC_UTF8), (error_t)SSNO_ERROR);
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(SSGZipDevice::isCompressed(&file));
+    file.close();
+
+    SSXMLDocument stored;
+    QCOMPARE(stored.open(path), (error_t)SSNO_ERROR);
+    QVERIFY(stored.isEqualTo(&document));
+
+    /* The compact document reads the same file. */
+    SSXMLCompactDocument lazy, utf16;
+    QCOMPARE(lazy.load(path), (error_t)SSNO_ERROR);
+    QCOMPARE(utf16.assign(&document), (error_t)SSNO_ERROR);
+    QCOMPARE(__bench_dump(lazy), __bench_dump(utf16));
+}
+/*}}}*/
+// void SSXMLBenchmark::queryParse();/*{{{*/
+void SSXMLBenchmark::queryParse_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<bool>("valid");
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("children")       << QString("a/b")               << true  << 3;
+    QTest::newRow("descendants")    << QString("//a")               << true  << 3;
+    QTest::newRow("equal")          << QString("//a[@x='1']/b")     << true  << 3;
+    QTest::newRow("not equal")      << QString("a[@x!=\"1\"]")      << true  << 1;
+    QTest::newRow("has")            << QString("*[ @x ]")           << true  << 2;
+    QTest::newRow("position")       << QString("a[2]")              << true  << 1;
+    QTest::newRow("absolute")       << QString("/r/a[1]/b[2]")      << true  << 1;
+    QTest::newRow("nested")         << QString("c//b")              << true  << 1;
+    QTest::newRow("self")           << QString(".")                 << true  << 1;
+    QTest::newRow("root")           << QString("/")                 << true  << 1;
+    QTest::newRow("empty")          << QString("")                  << false << 0;
+    QTest::newRow("trailing slash") << QString("a/")                << false << 0;
+    QTest::newRow("trailing axis")  << QString("a//")               << false << 0;
+    QTest::newRow("open bracket")   << QString("a[")                << false << 0;
+    QTest::newRow("open quote")     << QString("a[@x='1]")          << false << 0;
+    QTest::newRow("no attribute")   << QString("a[@]")              << false << 0;
+    QTest::newRow("zero position")  << QString("a[0]")              << false << 0;
+    QTest::newRow("self predicate") << QString(".[1]")              << false << 0;
+    QTest::newRow("descendant dot") << QString("//.")               << false << 0;
+    QTest::newRow("space in path")  << QString("a b")               << false << 0;
+}
+void SSXMLBenchmark::queryParse()
+{
+    QFETCH(QString, expression);
+    QFETCH(bool, valid);
+    QFETCH(int, count);
+
+    SSXMLDocument document;
+    QCOMPARE(document.open(QByteArray("<r><a x=\"1\"><b/><b/></a><a x=\"2\"><b/></a><c><a x=\"1\"><b/></a></c></r>")), (error_t)SSNO_ERROR);
+
+    SSXMLQuery query;
+    QCOMPARE(query.compile(expression), (error_t)(valid ? SSNO_ERROR : SSE_INVAL));
+    QCOMPARE(query.isValid(), valid);
+    QCOMPARE(query.expression(), (valid ? expression : QString()));
+    QCOMPARE((int)query.count(&document), count);
+}
+/*}}}*/
+///@} Checks
+
+/* ------------------------------------------------------------------------ */
+/*! \name Benchmarks */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLBenchmark::openFile();/*{{{*/
+void SSXMLBenchmark::openFile_data() { rows(); }
+void SSXMLBenchmark::openFile()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    QString path = fileOf(shape, size);
+
+    QBENCHMARK {
+        SSXMLDocument doc;
+        QVERIFY(doc.open(path) == SSNO_ERROR);
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::openMemory();/*{{{*/
+void SSXMLBenchmark::openMemory_data() { rows(); }
+void SSXMLBenchmark::openMemory()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    const QByteArray &data = document(shape, size);
+
+    QBENCHMARK {
+        SSXMLDocument doc;
+        QVERIFY(doc.open(data) == SSNO_ERROR);
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::openResource();/*{{{*/
+void SSXMLBenchmark::openResource_data() { rows(); }
+void SSXMLBenchmark::openResource()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    QString path = resourceOf(shape, size);
+    if (path.isEmpty())
+        QSKIP("The resource compiler failed");
+
+    QBENCHMARK {
+        SSXMLDocument doc;
+        QVERIFY(doc.open(path) == SSNO_ERROR);
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::write();/*{{{*/
+void SSXMLBenchmark::write_data() { rows(); }
+void SSXMLBenchmark::write()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    SSXMLDocument doc;
+    QVERIFY(doc.open(document(shape, size)) == SSNO_ERROR);
+
+    QBENCHMARK {
+        QBuffer buffer;
+        QVERIFY(doc.write(&buffer, SSENC_UTF8) == SSNO_ERROR);
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::toString();/*{{{*/
+void SSXMLBenchmark::toString_data() { rows(); }
+void SSXMLBenchmark::toString()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    SSXMLDocument doc;
+    QVERIFY(doc.open(document(shape, size)) == SSNO_ERROR);
+
+    QBENCHMARK {
+        QString text = doc.toString();
+        QVERIFY(!text.isEmpty());
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::assign();/*{{{*/
+void SSXMLBenchmark::assign_data() { rows(); }
+void SSXMLBenchmark::assign()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    SSXMLDocument doc;
+    QVERIFY(doc.open(document(shape, size)) == SSNO_ERROR);
+
+    QBENCHMARK {
+        SSXMLElement copy;
+        copy.assign(&doc);
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::isEqualTo();/*{{{*/
+void SSXMLBenchmark::isEqualTo_data() { rows(); }
+void SSXMLBenchmark::isEqualTo()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    SSXMLDocument doc;
+    QVERIFY(doc.open(document(shape, size)) == SSNO_ERROR);
+
+    SSXMLElement copy(doc);
+
+    QBENCHMARK {
+        QVERIFY(doc.isEqualTo(&copy));
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::attribute();/*{{{*/
+void SSXMLBenchmark::attribute_data() { rows(); }
+void SSXMLBenchmark::attribute()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    SSXMLDocument doc;
+    QVERIFY(doc.open(document(shape, size)) == SSNO_ERROR);
+
+    QList<const SSXMLElement*> elements;
+    QString name("id");
+    size_t limit;
+
+    __bench_collect(&doc, &elements);
+    limit = elements.count();
+
+    QBENCHMARK {
+        size_t found = 0;
+
+        for (size_t i = 0; i < limit; ++i)
+        {
+            if (elements.at(i)->has(name))
+                found += elements.at(i)->attribute(name).length();
+        }
+        QVERIFY(found > 0);
+    }
+}
+/*}}}*/
+// void SSXMLBenchmark::find();/*{{{*/
+void SSXMLBenchmark::find_data() { rows(); }
+void SSXMLBenchmark::find()
+{
+    QFETCH(int, shape);
+    QFETCH(qint64, size);
+
+    SSXMLDocument doc;
+    QVERIFY(doc.open(document(shape, size)) == SSNO_ERROR);
+
+    QList<const SSXMLElement*> elements;
+    QString name("id");
+    size_t limit;
+
+    __bench_collect(&doc, &elements);
+    limit = elements.count();
+
+    QBENCHMARK {
+        const QString *value;
+        size_t found = 0;
+
+        for (size_t i = 0; i < limit; ++i)
+        {
+            if ((value = elements.at(i)->find(name)) != NULL)
+                found += value->length();
+        }
+        QVERIFY(found > 0);
+    }
+}
+/*}}}*/
+///@} Benchmarks
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLBenchmark::rows();/*{{{*/
+/**
+ * Adds the rows of a benchmark.
+ * One row for each shape and size up to the size limit.
+ *//* --------------------------------------------------------------------- */
+void SSXMLBenchmark::rows()
+{
+    static const char *shapes[] = { "wide", "deep", "attributes", "text" };
+    static const char *labels[] = { "1K", "64K", "4M", "64M", "500M" };
+    static const qint64 sizes[] = {
+        Q_INT64_C(1024), Q_INT64_C(64) * 1024, Q_INT64_C(4) * 1024 * 1024,
+        Q_INT64_C(64) * 1024 * 1024, Q_INT64_C(500) * 1024 * 1024
+    };
+
+    QTest::addColumn<int>("shape");
+    QTest::addColumn<qint64>("size");
+
+    for (int shape = SSBENCH_WIDE; shape <= SSBENCH_TEXT; ++shape)
+    {
+        for (size_t i = 0; (i < 5) && (sizes[i] <= m_limit); ++i)
+        {
+            QByteArray name = QByteArray(shapes[shape]) + '-' + labels[i];
+            QTest::newRow(name.constData()) << shape << sizes[i];
+        }
+    }
+}
+/*}}}*/
+// const QByteArray& SSXMLBenchmark::document(int shape, qint64 size);/*{{{*/
+/**
+ * Gets a generated document.
+ * The last document generated is kept, so it is generated once for all the
+ * rows that use it.
+ *//* --------------------------------------------------------------------- */
+const QByteArray& SSXMLBenchmark::document(int shape, qint64 size)
+{
+    if ((shape != m_shape) || (size != m_size))
+    {
+        m_data.clear();                 /* Releases it before generating. */
+        m_data  = __bench_generate(shape, size);
+        m_shape = shape;
+        m_size  = size;
+    }
+    return m_data;
+}
+/*}}}*/
+// QString SSXMLBenchmark::fileOf(int shape, qint64 size);/*{{{*/
+/**
+ * Writes a generated document in a file.
+ * @returns The path of the file.
+ *//* --------------------------------------------------------------------- */
+QString SSXMLBenchmark::fileOf(int shape, qint64 size)
+{
+    QString path = m_folder.path() + "/document.xml";
+    QString key  = QString("%1:%2").arg(shape).arg(size);
+
+    if (m_file != key)
+    {
+        QFile file(path);
+
+        m_file.clear();
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return path;
+        if (file.write(document(shape, size)) == m_data.size())
+            m_file = key;
+    }
+    return path;
+}
+/*}}}*/
+// QString SSXMLBenchmark::resourceOf(int shape, qint64 size);/*{{{*/
+/**
+ * Builds a resource with a generated document.
+ * The document is compiled by the \c rcc tool into a binary resource file,
+ * with no compression, that is registered in the application.
+ * @returns The path of the document in the resource. An empty string when
+ * \c rcc fails.
+ *//* --------------------------------------------------------------------- */
+QString SSXMLBenchmark::resourceOf(int shape, qint64 size)
+{
+    QString key  = QString("%1:%2").arg(shape).arg(size);
+    QString rcc  = m_folder.path() + "/document.rcc";
+    QString qrc  = m_folder.path() + "/document.qrc";
+    QString path = fileOf(shape, size);
+
+    if (m_resource == key)
+        return QString(":/bench/document.xml");
+
+    if (!m_resource.isEmpty())
+    {
+        QResource::unregisterResource(rcc);
+        m_resource.clear();
+    }
+
+    QFile file(qrc);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return QString();
+
+    file.write("<RCC><qresource prefix=\"/bench\">");
+    file.write("<file alias=\"document.xml\">");
+    file.write(path.toUtf8());
+    file.write("</file></qresource></RCC>\n");
+    file.close();
+
+    QProcess process;
+    QStringList args;
+
+    args << "-binary" << "-no-compress" << qrc << "-o" << rcc;
+    process.start(QLibraryInfo::location(QLibraryInfo::BinariesPath) + "/rcc", args);
+
+    if (!process.waitForFinished(-1) || (process.exitCode() != 0))
+        return QString();
+
+    if (!QResource::registerResource(rcc))
+        return QString();
+
+    m_resource = key;
+    return QString(":/bench/document.xml");
+}
+/*}}}*/
+///@} Implementation
+
+// static QByteArray __bench_generate(int shape, qint64 size);/*{{{*/
+static QByteArray __bench_generate(int shape, qint64 size)
+{
+    static const char text[] =
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+        "eiusmod tempor incididunt ut labore et dolore magna aliqua &amp; "
+        "ut enim ad minim veniam, quis nostrud exercitation ullamco laboris "
+        "nisi ut aliquip ex ea commodo consequat. ";
+
+    QByteArray data;
+    qint64 id = 0;
+
+    data.reserve((int)size + 1024);
+    data.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<bench>\n");
+
+    while ((qint64)data.size() < size)
+    {
+        QByteArray number = QByteArray::number(id++);
+
+        switch (shape)
+        {
+        case SSBENCH_WIDE:
+            data.append("  <item id=\"").append(number);
+            data.append("\" name=\"item").append(number).append("\"/>\n");
+            break;
+        case SSBENCH_DEEP:
+            for (int depth = 0; depth < 64; ++depth)
+            {
+                data.append("<level id=\"").append(number).append('.');
+                data.append(QByteArray::number(depth)).append("\">");
+            }
+            data.append("<leaf id=\"").append(number).append("\">end</leaf>");
+            for (int depth = 0; depth < 64; ++depth)
+                data.append("</level>");
+            data.append('\n');
+            break;
+        case SSBENCH_ATTRIBUTES:
+            data.append("  <item id=\"").append(number).append('"');
+            for (int attr = 0; attr < 16; ++attr)
+            {
+                data.append(" attr").append(QByteArray::number(attr)).append("=\"");
+                data.append("value ").append(number).append('"');
+            }
+            data.append("/>\n");
+            break;
+        case SSBENCH_TEXT:
+            data.append("  <para id=\"").append(number).append("\">");
+            for (int line = 0; line < 4; ++line)
+                data.append(text);
+            data.append("</para>\n");
+            break;
+        }
+    }
+    data.append("</bench>\n");
+    return data;
+}
+/*}}}*/
+// static qint64 __bench_limit();/*{{{*/
+static qint64 __bench_limit()
+{
+    QByteArray value = qgetenv("SSQT_BENCH_MAX").trimmed().toUpper();
+    qint64 factor = 1;
+
+    if (value.isEmpty())
+        return SSBENCH_DEFAULT_MAX;
+
+    if (value.endsWith('K'))
+        factor = Q_INT64_C(1024);
+    else if (value.endsWith('M'))
+        factor = Q_INT64_C(1024) * 1024;
+    else if (value.endsWith('G'))
+        factor = Q_INT64_C(1024) * 1024 * 1024;
+
+    if (factor > 1)
+        value.chop(1);
+
+    bool success = false;
+    qint64 limit = value.toLongLong(&success);
+
+    return (success ? (limit * factor) : SSBENCH_DEFAULT_MAX);
+}
+/*}}}*/
+// static void __bench_collect(const SSXMLElement *root, QList<const SSXMLElement*> *list);/*{{{*/
+static void __bench_collect(const SSXMLElement *root, QList<const SSXMLElement*> *list)
+{
+    /* Breadth first. The list itself is the queue. */
+    list->append(root);
+
+    for (int i = 0; i < list->count(); ++i)
+    {
+        const SSXMLElement *element = list->at(i);
+        size_t limit = element->numberOfChildren();
+
+        for (size_t c = 0; c < limit; ++c)
+            list->append(element->elementAt((uint)c));
+    }
+}
+/*}}}*/
+// static QString __bench_dump(const SSXMLCompactDocument &document);/*{{{*/
+static QString __bench_dump(const SSXMLCompactDocument &document)
+{
+    size_t limit = document.numberOfElements();
+    QString result;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        SSXMLCompactElement element = document.elementAt((quint32)i);
+        size_t count = element.numberOfAttributes();
+        QStringList attributes;
+
+        for (size_t a = 0; a < count; ++a)
+            attributes.append(element.attributeName((uint)a) + '=' + element.attributeValue((uint)a));
+
+        attributes.sort();
+        result += QString("%1 %2 [%3] '%4'\n").arg(element.elementName())
+                                              .arg(element.numberOfChildren())
+                                              .arg(attributes.join(' '))
+                                              .arg(element.text());
+    }
+    return result;
+}
+/*}}}*/
+
+QTEST_GUILESS_MAIN(SSXMLBenchmark)
@@ -0,0 +1,101 @@
+/**
+ * \file
+ * Declares the SSXMLBenchmark class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTBNCH_HPP_DEFINED__
+#define __SSQTBNCH_HPP_DEFINED__
+
+#include <QObject>
+#include <QByteArray>
+#include <QString>
+#include <QTemporaryDir>
+
+/**
+ * Shapes of the generated documents.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSBENCH_WIDE        0   /**< Many small children of the root.       */
+#define SSBENCH_DEEP        1   /**< Long chains of nested elements.        */
+#define SSBENCH_ATTRIBUTES  2   /**< Elements with many attributes.         */
+#define SSBENCH_TEXT        3   /**< Elements with long texts.              */
+///@}
+
+/**
+ * Default size limit of the generated documents, in bytes.
+ * Changed with the \c SSQT_BENCH_MAX environment variable, that accepts the
+ * \b K, \b M and \b G suffixes.
+ **/
+#define SSBENCH_DEFAULT_MAX (4 * 1024 * 1024)
+
+/**
+ * Benchmarks of the XML layer.
+ * Each benchmark runs over generated documents of every shape, from 1 KB up
+ * to the size limit. Only one document is kept in memory at a time, since
+ * the rows are ordered by shape and size. Behavior checks run first, over
+ * small documents written in place.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    SSXMLBenchmark();
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void lazyParity_data();
+    void lazyParity();
+    void gzipRoundTrip_data();
+    void gzipRoundTrip();
+    void queryParse_data();
+    void queryParse();
+
+    void openFile_data();
+    void openFile();
+    void openMemory_data();
+    void openMemory();
+    void openResource_data();
+    void openResource();
+    void write_data();
+    void write();
+    void toString_data();
+    void toString();
+    void assign_data();
+    void assign();
+    void isEqualTo_data();
+    void isEqualTo();
+    void attribute_data();
+    void attribute();
+    void find_data();
+    void find();
+
+protected:      // Implementation
+    void rows();
+    const QByteArray& document(int shape, qint64 size);
+    QString fileOf(int shape, qint64 size);
+    QString resourceOf(int shape, qint64 size);
+
+protected:      // Data Members
+    QTemporaryDir m_folder;             /**< Where files are written.       */
+    qint64     m_limit;                 /**< Largest document size.         */
+    int        m_shape;                 /**< Shape of #m_data.              */
+    qint64     m_size;                  /**< Size of #m_data.               */
+    QByteArray m_data;                  /**< Current document.              */
+    QString    m_file;                  /**< Document in the file.          */
+    QString    m_resource;              /**< Document in the resource.      */
+};
+
+#endif /* __SSQTBNCH_HPP_DEFINED__ */
@@ -0,0 +1,40 @@
+# ============================================================================
+# XML Layer Benchmarks Qt Project File
+# ============================================================================
+#
+# Run with 'make check' or directly. Results are written in a machine
+# readable format with the QtTest output options:
+#
+#   ssqtbench -o results.xml,xml
+#   ssqtbench -o results.csv,csv
+#
+# Inputs are generated when the benchmarks run. By default the largest is
+# 4 MB. The SSQT_BENCH_MAX environment variable raises the limit up to 500 MB.
+
+QT        += widgets testlib
+TEMPLATE   = app
+CONFIG    += console testcase
+CONFIG    -= app_bundle
+TARGET     = ssqtbench
+
+INCLUDEPATH += ../source
+DEPENDPATH  += ../source
+
+# The library is built by the parent project in its 'build' folder.
+LIBS += -L$$OUT_PWD/../source/build -lssqt
+
+win32 {
+  PRE_TARGETDEPS += $$OUT_PWD/../source/build/ssqt.lib
+} else {
+  PRE_TARGETDEPS += $$OUT_PWD/../source/build/libssqt.a
+  LIBS += -lz
+}
+
+CONFIG(debug, debug|release) {
+  DEFINES += DEBUG
+} else {
+  DEFINES += NDEBUG
+}
+
+HEADERS += ssqtbnch.hpp
+SOURCES += ssqtbnch.cpp
@@ -21,10 +21,22 @@
 #include "ssqtdbg.hpp"
 #include "ssqtxmle.hpp"
 #include "ssqtxmld.hpp"
+#include "ssqtxmlc.hpp"
+#include "ssqtxmls.hpp"
+#include "ssqtxmlb.hpp"
+#include "ssqtxmlf.hpp"
+#include "ssqtxmlr.hpp"
+#include "ssqtxmlw.hpp"
+#include "ssqtxmlt.hpp"
+#include "ssqtxmlq.hpp"
+#include "ssqtxmlx.hpp"
+#include "ssqtxmlj.hpp"
+#include "ssqtxmlv.hpp"
 #include "ssqtmnui.hpp"
 #include "ssqtmnup.hpp"
 #include "ssqtmenu.hpp"
 #include "ssqtasst.hpp"
+#include "ssqtgzip.hpp"
 #include "ssqtmain.hpp"
 #include "ssqtapp.hpp"
 
@@ -16,6 +16,13 @@ DESTDIR    = build
 # If others libraries are needed:
 # LIBS += -L/lib/path -llibrary_name
 
+# zlib, used by SSGZipDevice. On Windows the copy bundled with Qt is used.
+win32 {
+  INCLUDEPATH += $$[QT_INSTALL_HEADERS]/QtZlib
+} else {
+  LIBS += -lz
+}
+
 CONFIG(debug, debug|release) {
   # Instalation folder for debugging
   target.path = $$(WORKHOME)/libs/libssqt-$$VERSION/x86/dbg
@@ -35,8 +42,20 @@ HEADERS += libssqt.h \
     ssqterr.hpp \
     ssqtdbg.hpp \
     ssqtasst.hpp \
+    ssqtgzip.hpp \
     ssqtxmle.hpp \
     ssqtxmld.hpp \
+    ssqtxmlc.hpp \
+    ssqtxmls.hpp \
+    ssqtxmlb.hpp \
+    ssqtxmlf.hpp \
+    ssqtxmlr.hpp \
+    ssqtxmlw.hpp \
+    ssqtxmlt.hpp \
+    ssqtxmlq.hpp \
+    ssqtxmlx.hpp \
+    ssqtxmlj.hpp \
+    ssqtxmlv.hpp \
     ssqtmnui.hpp \
     ssqtmnup.hpp \
     ssqtmenu.hpp \
@@ -48,8 +67,20 @@ HEADERS += libssqt.h \
 # SOURCES: .c or .cpp files to be compiled {{{
 SOURCES += ssqtdbg.cpp \
     ssqtasst.cpp \
+    ssqtgzip.cpp \
     ssqtxmle.cpp \
     ssqtxmld.cpp \
+    ssqtxmlc.cpp \
+    ssqtxmls.cpp \
+    ssqtxmlb.cpp \
+    ssqtxmlf.cpp \
+    ssqtxmlr.cpp \
+    ssqtxmlw.cpp \
+    ssqtxmlt.cpp \
+    ssqtxmlq.cpp \
+    ssqtxmlx.cpp \
+    ssqtxmlj.cpp \
+    ssqtxmlv.cpp \
     ssqtmnui.cpp \
     ssqtmnup.cpp \
     ssqtmenu.cpp \
@@ -0,0 +1,347 @@
+/**
+ * \file
+ * Defines the SSGZipDevice class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtgzip.hpp"
+#include <zlib.h>
+
+/**
+ * @internal
+ * Size of the blocks of compressed data read from or written to the
+ * underlying device.
+ **/
+#define SSGZIP_BUFFER_SIZE  16384
+
+/**
+ * @internal
+ * Window bits for \c inflateInit2() and \c deflateInit2().
+ * Adding 16 selects the gzip format. Adding 32 detects gzip or zlib headers.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSGZIP_WBITS_WRITE  (MAX_WBITS + 16)
+#define SSGZIP_WBITS_READ   (MAX_WBITS + 32)
+///@}
+
+/* ===========================================================================
+ * SSGZipDevice class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSGZipDevice::SSGZipDevice(QIODevice *device, QObject *parent = NULL);/*{{{*/
+SSGZipDevice::SSGZipDevice(QIODevice *device, QObject *parent) : QIODevice(parent),
+    m_device(device), m_stream(NULL), m_level(Z_DEFAULT_COMPRESSION),
+    m_closeDevice(false), m_finished(false)
+{
+}
+/*}}}*/
+// SSGZipDevice::~SSGZipDevice();/*{{{*/
+/**
+ * Destructor.
+ * Closes the device if it is still open.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSGZipDevice::~SSGZipDevice()
+{
+    close();
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Overrides */ //@{
+/* ------------------------------------------------------------------------ */
+// bool SSGZipDevice::open(OpenMode mode);/*{{{*/
+bool SSGZipDevice::open(OpenMode mode)
+{
+    OpenMode access = (mode & QIODevice::ReadWrite);
+
+    if (isOpen() || !m_device || (access == QIODevice::ReadWrite) || (access == QIODevice::NotOpen))
+    {
+        setErrorString(QString("Invalid open mode or device"));
+        return false;
+    }
+
+    m_closeDevice = !m_device->isOpen();
+    if (m_closeDevice && !m_device->open(access))
+    {
+        setErrorString(m_device->errorString());
+        return false;
+    }
+
+    if ((m_device->openMode() & access) != access)
+    {
+        setErrorString(QString("Device not open in the requested mode"));
+        release();
+        return false;
+    }
+
+    int status;
+
+    m_stream = new z_stream;
+    memset(m_stream, 0, sizeof(z_stream));
+
+    if (access == QIODevice::ReadOnly)
+        status = inflateInit2(m_stream, SSGZIP_WBITS_READ);
+    else
+        status = deflateInit2(m_stream, m_level, Z_DEFLATED, SSGZIP_WBITS_WRITE, 8, Z_DEFAULT_STRATEGY);
+
+    if (status != Z_OK)
+    {
+        sstrace("zlib error: %d", status);
+        setErrorString(QString("Failed to initialize the zlib stream"));
+        delete m_stream;
+        m_stream = NULL;
+        release();
+        return false;
+    }
+
+    m_buffer.resize(SSGZIP_BUFFER_SIZE);
+    m_finished = false;
+
+    return QIODevice::open(mode);
+}
+/*}}}*/
+// void SSGZipDevice::close();/*{{{*/
+void SSGZipDevice::close()
+{
+    if (!isOpen()) return;
+
+    if (openMode() & QIODevice::WriteOnly)
+    {
+        if (!m_finished) finish();
+        deflateEnd(m_stream);
+    }
+    else
+        inflateEnd(m_stream);
+
+    delete m_stream;
+    m_stream = NULL;
+    m_buffer.clear();
+
+    QIODevice::close();
+    release();
+}
+/*}}}*/
+// bool SSGZipDevice::isSequential() const;/*{{{*/
+bool SSGZipDevice::isSequential() const
+{
+    return true;
+}
+/*}}}*/
+// bool SSGZipDevice::atEnd() const;/*{{{*/
+bool SSGZipDevice::atEnd() const
+{
+    if (!isOpen()) return true;
+    return (m_finished && (QIODevice::bytesAvailable() == 0));
+}
+/*}}}*/
+// qint64 SSGZipDevice::readData(char *data, qint64 maxSize);/*{{{*/
+qint64 SSGZipDevice::readData(char *data, qint64 maxSize)
+{
+    if (m_finished || (maxSize <= 0)) return 0;
+
+    int status;
+    uInt limit = (uInt)qMin(maxSize, (qint64)SSGZIP_BUFFER_SIZE * 4);
+
+    m_stream->next_out  = (Bytef *)data;
+    m_stream->avail_out = limit;
+
+    while (m_stream->avail_out > 0)
+    {
+        if ((m_stream->avail_in == 0) && (fill() <= 0))
+        {
+            /* Input finished before the end of the compressed stream. */
+            if (!m_finished) setErrorString(QString("Unexpected end of compressed data"));
+            m_finished = true;
+            break;
+        }
+
+        status = inflate(m_stream, Z_NO_FLUSH);
+        if (status == Z_STREAM_END)
+        {
+            /* Files can have several concatenated gzip members. */
+            if ((m_stream->avail_in == 0) && (fill() <= 0))
+            {
+                m_finished = true;
+                break;
+            }
+            inflateReset(m_stream);
+        }
+        else if ((status != Z_OK) && (status != Z_BUF_ERROR))
+        {
+            sstrace("zlib error: %d", status);
+            setErrorString(QString(m_stream->msg ? m_stream->msg : "Corrupted compressed data"));
+            m_finished = true;
+            return -1;
+        }
+    }
+    return (qint64)(limit - m_stream->avail_out);
+}
+/*}}}*/
+// qint64 SSGZipDevice::writeData(const char *data, qint64 maxSize);/*{{{*/
+qint64 SSGZipDevice::writeData(const char *data, qint64 maxSize)
+{
+    qint64 written = 0;
+    uInt   count;
+
+    if (m_finished)
+    {
+        setErrorString(QString("Compressed stream already finished"));
+        return -1;
+    }
+
+    while (written < maxSize)
+    {
+        count = (uInt)qMin(maxSize - written, (qint64)SSGZIP_BUFFER_SIZE * 4);
+
+        m_stream->next_in  = (Bytef *)(data + written);
+        m_stream->avail_in = count;
+
+        if (!deflateAll(Z_NO_FLUSH))
+            return -1;
+
+        written += count;
+    }
+    return written;
+}
+/*}}}*/
+///@} Overrides
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// bool SSGZipDevice::finish();/*{{{*/
+bool SSGZipDevice::finish()
+{
+    if (!isOpen() || !(openMode() & QIODevice::WriteOnly))
+    {
+        setErrorString(QString("Device not open for writing"));
+        return false;
+    }
+    if (m_finished) return true;
+
+    m_stream->next_in  = NULL;
+    m_stream->avail_in = 0;
+
+    if (!deflateAll(Z_FINISH))
+        return false;
+
+    QFileDevice *file = qobject_cast<QFileDevice*>(m_device);
+    if (file && !file->flush())
+    {
+        setErrorString(file->errorString());
+        return false;
+    }
+
+    m_finished = true;
+    return true;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Static Functions */ //@{
+/* ------------------------------------------------------------------------ */
+// bool SSGZipDevice::isCompressed(QIODevice *device);/*{{{*/
+bool SSGZipDevice::isCompressed(QIODevice *device)
+{
+    if (!device) return false;
+    return isCompressed(device->peek(2));
+}
+/*}}}*/
+// bool SSGZipDevice::isCompressed(const QByteArray &data);/*{{{*/
+bool SSGZipDevice::isCompressed(const QByteArray &data)
+{
+    return ((data.size() >= 2) && ((uchar)data.at(0) == 0x1F) && ((uchar)data.at(1) == 0x8B));
+}
+/*}}}*/
+///@} Static Functions
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// qint64 SSGZipDevice::fill();/*{{{*/
+/**
+ * Reads the next block of compressed data from the underlying device.
+ * @returns The number of bytes read. Zero at the end of the device. Less
+ * than zero on errors.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+qint64 SSGZipDevice::fill()
+{
+    qint64 count = m_device->read(m_buffer.data(), m_buffer.size());
+
+    if (count < 0)
+        setErrorString(m_device->errorString());
+
+    m_stream->next_in  = (Bytef *)m_buffer.data();
+    m_stream->avail_in = (uInt)qMax(count, (qint64)0);
+
+    return count;
+}
+/*}}}*/
+// bool SSGZipDevice::deflateAll(int flush);/*{{{*/
+/**
+ * Compresses the pending input and writes it to the underlying device.
+ * @param flush \c Z_NO_FLUSH to compress data as it is written. \c Z_FINISH
+ * to end the compressed stream.
+ * @return \b true on success. \b false when the underlying device fails.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSGZipDevice::deflateAll(int flush)
+{
+    qint64 count;
+    int status;
+
+    do {
+        m_stream->next_out  = (Bytef *)m_buffer.data();
+        m_stream->avail_out = (uInt)m_buffer.size();
+
+        status = deflate(m_stream, flush);
+        if (status == Z_STREAM_ERROR)
+        {
+            setErrorString(QString("Invalid zlib stream state"));
+            return false;
+        }
+
+        count = m_buffer.size() - m_stream->avail_out;
+        if ((count > 0) && (m_device->write(m_buffer.constData(), count) != count))
+        {
+            setErrorString(m_device->errorString());
+            return false;
+        }
+    } while (m_stream->avail_out == 0);
+
+    return true;
+}
+/*}}}*/
+// void SSGZipDevice::release();/*{{{*/
+/**
+ * Closes the underlying device when it was opened by this object.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSGZipDevice::release()
+{
+    if (m_closeDevice && m_device)
+        m_device->close();
+
+    m_closeDevice = false;
+}
+/*}}}*/
+///@} Implementation
+
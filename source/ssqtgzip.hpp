@@ -0,0 +1,216 @@
+/**
+ * \file
+ * Declares the SSGZipDevice class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTGZIP_HPP_DEFINED__
+#define __SSQTGZIP_HPP_DEFINED__
+
+#include <QIODevice>
+#include <QByteArray>
+#include "ssqtcmn.hpp"
+
+/**
+ * @internal
+ * Forward declarations.
+ * @{ *//* ---------------------------------------------------------------- */
+struct z_stream_s;
+///@} internal
+
+/**
+ * \ingroup ssqt_xml
+ * Suffix of file names that are written compressed.
+ * Used by \c SSXMLDocument to select the compressed format when writing.
+ * @since 1.1
+ **/
+#define SSGZIP_SUFFIX       ".gz"
+
+/**
+ * @ingroup ssqt_xml
+ * A sequential device that compresses or decompresses another device.
+ * Data written to this device is compressed in the \e gzip format and
+ * written to the underlying device. Data read from this device is read from
+ * the underlying device and decompressed. Both, \e gzip and \e zlib formats
+ * are recognized when reading.
+ *
+ * The work is done in small blocks as the data flows, so the whole content
+ * is never kept in memory. A \c QXmlStreamReader reading from this device
+ * parses the document while it is decompressed.
+ *
+ * The device can be opened for reading or for writing, not both. When the
+ * underlying device is not open, it is opened with the same mode and closed
+ * when this device is closed. When writing, the compressed stream is only
+ * complete after #finish() or #close() is called. Only #finish() reports
+ * whether the end of the stream was written.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * QFile file("snapshot.xml.gz");
+ * SSGZipDevice zip(&file);
+ *
+ * if (zip.open(QIODevice::ReadOnly))
+ * {
+ *     QXmlStreamReader reader(&zip);
+ *     // ...
+ * }
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSGZipDevice : public QIODevice
+{
+    Q_OBJECT
+
+public:
+    // explicit SSGZipDevice(QIODevice *device, QObject *parent = NULL);/*{{{*/
+    /**
+     * Default constructor.
+     * @param device The underlying device. Its ownership is not taken.
+     * @param parent The parent (owner) object. Can be \b NULL.
+     * @since 1.1
+     **/
+    explicit SSGZipDevice(QIODevice *device, QObject *parent = NULL);
+    /*}}}*/
+    virtual ~SSGZipDevice();
+
+public:         // Attributes
+    // QIODevice* device() const;/*{{{*/
+    /**
+     * The underlying device.
+     * @since 1.1
+     **/
+    QIODevice* device() const;
+    /*}}}*/
+    // int  compressionLevel() const;/*{{{*/
+    /**
+     * Compression level used when writing.
+     * @returns A value from \b 0 (no compression) to \b 9 (best
+     * compression) or \b -1, the default level of the \e zlib library.
+     * @since 1.1
+     **/
+    int  compressionLevel() const;
+    /*}}}*/
+    // void compressionLevel(int level);/*{{{*/
+    /**
+     * Changes the compression level used when writing.
+     * @param level A value from \b 0 (no compression) to \b 9 (best
+     * compression) or \b -1 to use the default level of the \e zlib library.
+     * @remarks Must be set before the device is opened.
+     * @since 1.1
+     **/
+    void compressionLevel(int level);
+    /*}}}*/
+
+public:         // Overrides
+    // virtual bool open(OpenMode mode);/*{{{*/
+    /**
+     * Opens the device.
+     * @param mode The open mode. Must have \c QIODevice::ReadOnly or \c
+     * QIODevice::WriteOnly but not both.
+     * @return \b true on success. \b false otherwise. The reason of the
+     * failure is available through \c errorString().
+     * @since 1.1
+     **/
+    virtual bool open(OpenMode mode);
+    /*}}}*/
+    // virtual void close();/*{{{*/
+    /**
+     * Closes the device.
+     * When writing, the compressed stream is finished and the remaining data
+     * is written to the underlying device.
+     * @since 1.1
+     **/
+    virtual void close();
+    /*}}}*/
+    virtual bool isSequential() const;
+    virtual bool atEnd() const;
+
+public:         // Operations
+    // bool finish();/*{{{*/
+    /**
+     * Finishes the compressed stream.
+     * The remaining compressed data and the \e gzip trailer are written to
+     * the underlying device, that is flushed when it is a file.
+     * @return \b true on success. \b false when the device is not open for
+     * writing or when the underlying device fails. The reason of the
+     * failure is available through \c errorString().
+     * @remarks Nothing can be written after this call. #close() calls this
+     * function when it was not called, but cannot report failures.
+     * @since 1.1
+     **/
+    bool finish();
+    /*}}}*/
+
+public:         // Static Functions
+    // static bool isCompressed(QIODevice *device);/*{{{*/
+    /**
+     * Checks whether a device has compressed data.
+     * @param device The device to check. Must be open for reading.
+     * @returns \b true when the next bytes to read from \a device are the
+     * header of a \e gzip stream. Otherwise \b false.
+     * @remarks Data is peeked, not read, from the device.
+     * @since 1.1
+     **/
+    static bool isCompressed(QIODevice *device);
+    /*}}}*/
+    // static bool isCompressed(const QByteArray &data);/*{{{*/
+    /**
+     * Checks whether an array of bytes has compressed data.
+     * @param data The bytes to check.
+     * @returns \b true when \a data starts with the header of a \e gzip
+     * stream. Otherwise \b false.
+     * @since 1.1
+     **/
+    static bool isCompressed(const QByteArray &data);
+    /*}}}*/
+
+protected:      // Overrides
+    virtual qint64 readData(char *data, qint64 maxSize);
+    virtual qint64 writeData(const char *data, qint64 maxSize);
+
+protected:      // Implementation
+    qint64 fill();
+    bool   deflateAll(int flush);
+    void   release();
+
+protected:      // Data Members
+    QIODevice *m_device;                /**< The underlying device.         */
+    struct z_stream_s *m_stream;        /**< The zlib stream state.         */
+    QByteArray m_buffer;                /**< Compressed data block.         */
+    int  m_level;                       /**< Compression level.             */
+    bool m_closeDevice;                 /**< We opened the device.          */
+    bool m_finished;                    /**< End of compressed stream.      */
+
+private:
+    Q_DISABLE_COPY(SSGZipDevice)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSGZipDevice *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline QIODevice* SSGZipDevice::device() const;/*{{{*/
+inline QIODevice* SSGZipDevice::device() const {
+    return m_device;
+}
+/*}}}*/
+// inline int SSGZipDevice::compressionLevel() const;/*{{{*/
+inline int SSGZipDevice::compressionLevel() const {
+    return m_level;
+}
+/*}}}*/
+// inline void SSGZipDevice::compressionLevel(int level);/*{{{*/
+inline void SSGZipDevice::compressionLevel(int level) {
+    m_level = level;
+}
+/*}}}*/
+///@} SSGZipDevice /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTGZIP_HPP_DEFINED__ */
@@ -30,7 +30,7 @@
 error_t SSMenu::loadMenu(SSXMLDocument *document)
 {
     if (document == NULL) return SSE_INVAL;
-    if (document->elementName != SS_MENU_NODE_MENU)
+    if (document->elementName != SSXMLKeys::menuMenu)
         return SSE_FTYPE;
 
     size_t limit = document->numberOfChildren();
@@ -39,7 +39,7 @@ error_t SSMenu::loadMenu(SSXMLDocument *document)
     for (size_t i = 0; i < limit; ++i)
     {
         element = document->elementAt(i);
-        if (element->elementName != SS_MENU_NODE_POPUP)
+        if (element->elementName != SSXMLKeys::menuPopup)
             continue;
 
         addPopup(element);
@@ -58,41 +58,43 @@ SSMenuItem& SSMenuItem::assign(const SSMenuItem &item)
 void SSMenuItem::init(SSXMLElement *element)
 {
     if (!element) return;
-    if ((element->elementName != SS_MENU_NODE_SEPARATOR)
-        && (element->elementName != SS_MENU_NODE_ITEM))
+    if ((element->elementName != SSXMLKeys::menuSeparator)
+        && (element->elementName != SSXMLKeys::menuItem))
         return;
 
-    if (element->elementName == SS_MENU_NODE_SEPARATOR)
+    if (element->elementName == SSXMLKeys::menuSeparator)
         setSeparator(true);
 
-    m_id = (uint)element->intValueOf(SS_MENU_ATTR_ID);
-    setText( element->attribute(SS_MENU_ATTR_TEXT).replace('_', '&') );
-    setStatusTip( element->attribute(SS_MENU_ATTR_DESC) );
+    const QString *value;
 
-    if (element->has(SS_MENU_ATTR_CHECKED))
+    m_id = (uint)element->intValueOf(SSXMLKeys::attrId);
+    setText( element->attribute(SSXMLKeys::attrText).replace('_', '&') );
+    setStatusTip( element->attribute(SSXMLKeys::attrDesc) );
+
+    if ((value = element->find(SSXMLKeys::attrChecked)) != NULL)
     {
         setCheckable(true);
-        setChecked( element->boolValueOf(SS_MENU_ATTR_CHECKED) );
+        setChecked( SSXMLElement::boolValue(*value) );
     }
 
-    if (element->has(SS_MENU_ATTR_ICON))
+    if ((value = element->find(SSXMLKeys::attrIcon)) != NULL)
     {
-        QIcon menuIcon( element->attribute(SS_MENU_ATTR_ICON) );
+        QIcon menuIcon( *value );
 
         setIcon( menuIcon );
         setIconVisibleInMenu( true );
     }
 
-    if (element->has(SS_MENU_ATTR_KEYS))
+    if ((value = element->find(SSXMLKeys::attrKeys)) != NULL)
     {
-        QKeySequence keys( element->attribute(SS_MENU_ATTR_KEYS) );
+        QKeySequence keys( *value );
 
         setShortcut( keys );
         setShortcutContext( Qt::WindowShortcut );
     }
 
-    if (element->has(SS_MENU_ATTR_NAME))
-        setObjectName( element->attribute(SS_MENU_ATTR_NAME) );
+    if ((value = element->find(SSXMLKeys::attrName)) != NULL)
+        setObjectName( *value );
 }
 /*}}}*/
 ///@} Implementation
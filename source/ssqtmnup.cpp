@@ -105,13 +105,14 @@ SSMenuPopup* SSMenuPopup::addPopup(SSMenuPopup *popup)
 error_t SSMenuPopup::loadMenu(SSXMLElement *element)
 {
     if (!element) return SSE_INVAL;
-    if (element->elementName != SS_MENU_NODE_POPUP)
+    if (element->elementName != SSXMLKeys::menuPopup)
         return SSE_INVAL;
 
-    if (element->has(SS_MENU_ATTR_REF))
+    const QString *value = element->find(SSXMLKeys::attrRef);
+    if (value != NULL)
     {
         SSMenuPopup *subMenu = new SSMenuPopup();
-        error_t result = subMenu->loadMenu(element->attribute(SS_MENU_ATTR_REF));
+        error_t result = subMenu->loadMenu(*value);
 
         if (result != SSNO_ERROR)
         {
@@ -121,13 +122,13 @@ error_t SSMenuPopup::loadMenu(SSXMLElement *element)
         addPopup(subMenu);
         return SSNO_ERROR;
     }
-    QString text( element->attribute(SS_MENU_ATTR_TEXT) );
+    QString text( element->attribute(SSXMLKeys::attrText) );
 
-    m_id = element->intValueOf(SS_MENU_ATTR_ID);
+    m_id = element->intValueOf(SSXMLKeys::attrId);
     setTitle( text.replace('_', '&') );
 
-    if (element->has(SS_MENU_ATTR_NAME))
-        setObjectName( element->attribute(SS_MENU_ATTR_NAME) );
+    if ((value = element->find(SSXMLKeys::attrName)) != NULL)
+        setObjectName( *value );
 
     if (element->hasChildren())
     {
@@ -137,7 +138,7 @@ error_t SSMenuPopup::loadMenu(SSXMLElement *element)
         for (size_t i = 0; i < limit; ++i)
         {
             node = element->elementAt(i);
-            if (node->elementName == SS_MENU_NODE_POPUP)
+            if (node->elementName == SSXMLKeys::menuPopup)
                 addPopup( node );
             else
                 addItem( node );
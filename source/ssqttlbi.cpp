@@ -60,28 +60,30 @@ SSButtonItem& SSButtonItem::assign(const SSButtonItem &button)
 void SSButtonItem::init(SSXMLElement *element)
 {
     if (!element) return;
-    if ((element->elementName != SS_MENU_NODE_SEPARATOR)
-        && (element->elementName != SS_XML_NODE_BUTTON))
+    if ((element->elementName != SSXMLKeys::menuSeparator)
+        && (element->elementName != SSXMLKeys::nodeButton))
         return;
 
-    if (element->elementName == SS_MENU_NODE_SEPARATOR)
+    if (element->elementName == SSXMLKeys::menuSeparator)
         setSeparator(true);
 
-    m_id = (uint)element->intValueOf(SS_MENU_ATTR_ID);
-    setText( element->attribute(SS_MENU_ATTR_TEXT) );
+    const QString *value;
 
-    if (element->has(SS_MENU_ATTR_CHECKED))
+    m_id = (uint)element->intValueOf(SSXMLKeys::attrId);
+    setText( element->attribute(SSXMLKeys::attrText) );
+
+    if ((value = element->find(SSXMLKeys::attrChecked)) != NULL)
     {
         setCheckable(true);
-        setChecked( element->boolValueOf(SS_MENU_ATTR_CHECKED) );
+        setChecked( SSXMLElement::boolValue(*value) );
     }
 
-    if (element->has(SS_XML_ATTR_ENABLED))
-        setEnabled(element->boolValueOf(SS_XML_ATTR_ENABLED));
+    if ((value = element->find(SSXMLKeys::attrEnabled)) != NULL)
+        setEnabled(SSXMLElement::boolValue(*value));
 
-    if (element->has(SS_MENU_ATTR_ICON))
+    if ((value = element->find(SSXMLKeys::attrIcon)) != NULL)
     {
-        QString resIcon = element->attribute(SS_MENU_ATTR_ICON);
+        const QString &resIcon = *value;
         QIcon   buttonIcon;
 
         if (resIcon.startsWith('#'))
@@ -92,23 +94,23 @@ void SSButtonItem::init(SSXMLElement *element)
         setIcon( buttonIcon );
     }
 
-    if (element->has(SS_MENU_ATTR_KEYS))
+    if ((value = element->find(SSXMLKeys::attrKeys)) != NULL)
     {
-        QKeySequence keys( element->attribute(SS_MENU_ATTR_KEYS) );
+        QKeySequence keys( *value );
 
         setShortcut( keys );
         setShortcutContext( Qt::WindowShortcut );
     }
 
-    if (element->has(SS_MENU_ATTR_NAME))
-        setObjectName( element->attribute(SS_MENU_ATTR_NAME) );
+    if ((value = element->find(SSXMLKeys::attrName)) != NULL)
+        setObjectName( *value );
 
     if (element->hasChildren())
     {
         /* Only one child is allowed. */
         SSXMLElement *node = element->firstElement();
 
-        if (node->elementName == SS_MENU_NODE_POPUP)
+        if (node->elementName == SSXMLKeys::menuPopup)
         {
             SSMenuPopup *popup = new SSMenuPopup(node);
             subMenu( popup );
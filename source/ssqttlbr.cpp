@@ -76,7 +76,7 @@ bool SSToolbar::init(const QString &filePath)
 bool SSToolbar::init(SSXMLDocument *doc)
 {
     if (doc == NULL) return false;
-    if (doc->elementName != SS_XML_NODE_TOOLBAR) return false;
+    if (doc->elementName != SSXMLKeys::nodeToolbar) return false;
 
     size_t limit = doc->numberOfChildren();
     SSXMLElement *node;
@@ -85,9 +85,9 @@ bool SSToolbar::init(SSXMLDocument *doc)
     for (size_t i = 0; i < limit; ++i)
     {
         node = doc->elementAt(i);
-        if (node->elementName == SS_MENU_NODE_SEPARATOR)
+        if (node->elementName == SSXMLKeys::menuSeparator)
             addSeparator();
-        else if (node->elementName == SS_XML_NODE_BUTTON)
+        else if (node->elementName == SSXMLKeys::nodeButton)
         {
             button = new SSButtonItem(node);
             addAction( button );
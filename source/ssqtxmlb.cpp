@@ -0,0 +1,148 @@
+/**
+ * \file
+ * Defines the SSXMLBindingBase class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmlb.hpp"
+
+/* ===========================================================================
+ * SSXMLBindingBase class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Conversion Functions */ //@{
+/* ------------------------------------------------------------------------ */
+// bool SSXMLBindingBase::convert(const QStringRef &text, QString *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, QString *result)
+{
+    *result = text.toString();
+    return true;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, QByteArray *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, QByteArray *result)
+{
+    *result = text.toUtf8();
+    return true;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, bool *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, bool *result)
+{
+    if ((text == QLatin1String("true")) || (text == QLatin1String("yes")))
+        *result = true;
+    else if ((text == QLatin1String("false")) || (text == QLatin1String("no")))
+        *result = false;
+    else
+    {
+        bool success = false;
+        int  value   = text.toInt(&success, 0);
+
+        if (!success) return false;
+        *result = (value != 0);
+    }
+    return true;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, int *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, int *result)
+{
+    bool success = false;
+    int  value   = text.toInt(&success, 0);
+
+    if (success) *result = value;
+    return success;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, uint *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, uint *result)
+{
+    bool success = false;
+    uint value   = text.toUInt(&success, 0);
+
+    if (success) *result = value;
+    return success;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, qint64 *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, qint64 *result)
+{
+    bool   success = false;
+    qint64 value   = text.toLongLong(&success, 0);
+
+    if (success) *result = value;
+    return success;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, quint64 *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, quint64 *result)
+{
+    bool    success = false;
+    quint64 value   = text.toULongLong(&success, 0);
+
+    if (success) *result = value;
+    return success;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, float *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, float *result)
+{
+    bool  success = false;
+    float value   = text.toFloat(&success);
+
+    if (success) *result = value;
+    return success;
+}
+/*}}}*/
+// bool SSXMLBindingBase::convert(const QStringRef &text, double *result);/*{{{*/
+bool SSXMLBindingBase::convert(const QStringRef &text, double *result)
+{
+    bool   success = false;
+    double value   = text.toDouble(&success);
+
+    if (success) *result = value;
+    return success;
+}
+/*}}}*/
+///@} Conversion Functions
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLBindingBase::readError(const QXmlStreamReader *reader);/*{{{*/
+error_t SSXMLBindingBase::readError(const QXmlStreamReader *reader)
+{
+    if (!reader->hasError())
+        return SSE_IO;              /* Document ended before the element. */
+
+    sstrace("%s\n", SST(reader->errorString()));
+    ssprint("=> at line: %d, column: %d", (int)reader->lineNumber(), (int)reader->columnNumber());
+
+    switch (reader->error())
+    {
+    case QXmlStreamReader::NotWellFormedError:
+    case QXmlStreamReader::UnexpectedElementError:
+        return SSE_FTYPE;
+    case QXmlStreamReader::PrematureEndOfDocumentError:
+        return SSE_IO;
+    default:
+        return SSE_FAULT;
+    }
+}
+/*}}}*/
+///@} Implementation
+
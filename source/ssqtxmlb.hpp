@@ -0,0 +1,513 @@
+/**
+ * \file
+ * Declares the SSXMLBinding template class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLB_HPP_DEFINED__
+#define __SSQTXMLB_HPP_DEFINED__
+
+#include <QString>
+#include <QStringRef>
+#include <QByteArray>
+#include <QIODevice>
+#include <QList>
+#include <QSharedPointer>
+#include <QXmlStreamReader>
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+
+/**
+ * @ingroup ssqt_xml
+ * Non template part of \c SSXMLBinding.
+ * Has the conversion functions used to convert attributes and texts to the
+ * types of the members of the bound structures. Each supported type has its
+ * own #convert() overload. Binding a member of a type without an overload
+ * fails at compile time, unless a conversion function is passed explicitly.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLBindingBase
+{
+public:         // Conversion Functions
+    /**
+     * Converts a text to a value.
+     * @param text The text of an attribute or element.
+     * @param result Receives the converted value. Not changed when the
+     * conversion fails.
+     * @return \b true on success. \b false when \a text is not valid for the
+     * type of \a result.
+     * @remarks Integers accept decimal, octal ("0" prefix) and hexadecimal
+     * ("0x" prefix) notations, like SSXMLElement::intValueOf(). Booleans
+     * accept "true", "yes", "false", "no" and integer numbers, like
+     * SSXMLElement::boolValueOf().
+     * @since 1.1
+     * @{ **/
+    static bool convert(const QStringRef &text, QString *result);
+    static bool convert(const QStringRef &text, QByteArray *result);
+    static bool convert(const QStringRef &text, bool *result);
+    static bool convert(const QStringRef &text, int *result);
+    static bool convert(const QStringRef &text, uint *result);
+    static bool convert(const QStringRef &text, qint64 *result);
+    static bool convert(const QStringRef &text, quint64 *result);
+    static bool convert(const QStringRef &text, float *result);
+    static bool convert(const QStringRef &text, double *result);
+    ///@}
+
+protected:      // Implementation
+    // static error_t readError(const QXmlStreamReader *reader);/*{{{*/
+    /**
+     * Translates the error of a reader.
+     * @param reader The reader that failed.
+     * @returns The error code, following the same rules of
+     * SSXMLDocument::open().
+     * @since 1.1
+     **/
+    static error_t readError(const QXmlStreamReader *reader);
+    /*}}}*/
+};
+
+/**
+ * @ingroup ssqt_xml
+ * Binds an XML element to a C++ structure.
+ * The binding is declared once, as a list of fields. Each field maps an
+ * attribute, the element text, or a child element to a member of the
+ * structure. Loading reads the XML stream a single time filling the
+ * structure directly. No \c SSXMLElement tree is built and attributes that
+ * are not bound are never converted to \c QString objects. Child elements
+ * without a binding are skipped.
+ *
+ * Member types are checked at compile time. Each bound member must have
+ * a SSXMLBindingBase::convert() overload or an explicit conversion function.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * struct Server  { QString host; int port; bool secure; };
+ * struct Network { QString name; uint timeout; QList<Server> servers; };
+ *
+ * static const SSXMLBinding<Server> serverBinding =
+ *     SSXMLBinding<Server>("server")
+ *         .attribute("host", &Server::host)
+ *         .attribute("port", &Server::port)
+ *         .attribute("secure", &Server::secure);
+ *
+ * static const SSXMLBinding<Network> networkBinding =
+ *     SSXMLBinding<Network>("network")
+ *         .attribute("name", &Network::name)
+ *         .element("timeout", &Network::timeout)
+ *         .children("server", &Network::servers, &serverBinding);
+ *
+ * Network network;
+ * QFile file("network.xml");
+ * error_t result = networkBinding.load(&file, &network);
+ * ~~~~~~~~~~~~~~
+ * Binding objects are cheap to copy. Fields are shared between copies. A
+ * binding that is not changed after it is built can be used by several
+ * threads at the same time.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+template <typename T>
+class SSXMLBinding : public SSXMLBindingBase
+{
+public:
+    // explicit SSXMLBinding(const char *elementName);/*{{{*/
+    /**
+     * Builds a binding without fields.
+     * @param elementName Name of the element bound to the structure.
+     * @since 1.1
+     **/
+    explicit SSXMLBinding(const char *elementName);
+    /*}}}*/
+
+public:         // Attributes
+    // QString elementName() const;/*{{{*/
+    /**
+     * Name of the bound element.
+     * @since 1.1
+     **/
+    QString elementName() const;
+    /*}}}*/
+
+public:         // Fields Declaration
+    // SSXMLBinding& attribute(const char *name, V T::*member);/*{{{*/
+    /**
+     * Binds an attribute to a member.
+     * @param name Name of the attribute.
+     * @param member Pointer to the member that receives the attribute value.
+     * @returns \b this, so declarations can be chained.
+     * @since 1.1
+     **/
+    template <typename V>
+    SSXMLBinding& attribute(const char *name, V T::*member);
+    /*}}}*/
+    // SSXMLBinding& attribute(const char *name, V T::*member, bool (*converter)(const QStringRef&, V*));/*{{{*/
+    /**
+     * Binds an attribute to a member using a custom conversion.
+     * @param name Name of the attribute.
+     * @param member Pointer to the member that receives the attribute value.
+     * @param converter Function that converts the attribute value. Must
+     * return \b false when the value is not valid.
+     * @returns \b this, so declarations can be chained.
+     * @since 1.1
+     **/
+    template <typename V>
+    SSXMLBinding& attribute(const char *name, V T::*member, bool (*converter)(const QStringRef&, V*));
+    /*}}}*/
+    // SSXMLBinding& text(V T::*member);/*{{{*/
+    /**
+     * Binds the text of the element to a member.
+     * @param member Pointer to the member that receives the text.
+     * @returns \b this, so declarations can be chained.
+     * @remarks Leading and trailing white space is removed before the
+     * conversion.
+     * @since 1.1
+     **/
+    template <typename V>
+    SSXMLBinding& text(V T::*member);
+    /*}}}*/
+    // SSXMLBinding& element(const char *name, V T::*member);/*{{{*/
+    /**
+     * Binds the text of a child element to a member.
+     * @param name Name of the child element.
+     * @param member Pointer to the member that receives the text of the
+     * child element.
+     * @returns \b this, so declarations can be chained.
+     * @remarks Used for simple elements like
+     * <tt>&lt;port&gt;80&lt;/port&gt;</tt>.
+     * When the child element occurs more than once, the last one is kept.
+     * @since 1.1
+     **/
+    template <typename V>
+    SSXMLBinding& element(const char *name, V T::*member);
+    /*}}}*/
+    // SSXMLBinding& child(const char *name, V T::*member, const SSXMLBinding<V> *binding);/*{{{*/
+    /**
+     * Binds a child element to a member structure.
+     * @param name Name of the child element.
+     * @param member Pointer to the member structure.
+     * @param binding The binding of the member structure. The object must
+     * live as long as this binding.
+     * @returns \b this, so declarations can be chained.
+     * @since 1.1
+     **/
+    template <typename V>
+    SSXMLBinding& child(const char *name, V T::*member, const SSXMLBinding<V> *binding);
+    /*}}}*/
+    // SSXMLBinding& children(const char *name, QList<V> T::*member, const SSXMLBinding<V> *binding);/*{{{*/
+    /**
+     * Binds a repeated child element to a list member.
+     * @param name Name of the child elements.
+     * @param member Pointer to the list member. Each child element found
+     * adds an item to the list. Items are default constructed before being
+     * loaded.
+     * @param binding The binding of the list items. The object must live as
+     * long as this binding.
+     * @returns \b this, so declarations can be chained.
+     * @since 1.1
+     **/
+    template <typename V>
+    SSXMLBinding& children(const char *name, QList<V> T::*member, const SSXMLBinding<V> *binding);
+    /*}}}*/
+
+public:         // Operations
+    // error_t read(QXmlStreamReader *reader, T *object) const;/*{{{*/
+    /**
+     * Loads a structure from a reader.
+     * @param reader The reader. Must be positioned at the start of the bound
+     * element. When the function returns successfully the reader is
+     * positioned at the end of the element.
+     * @param object The structure to fill. Members without a matching
+     * attribute or element are not changed.
+     * @return \b 0 (\c SSNO_ERROR) on success. \c SSE_INVAL when a value
+     * cannot be converted to the type of its member. Otherwise an error
+     * code. See SSXMLDocument::open() for the possible values.
+     * @remarks When a value cannot be converted the reading stops. Members
+     * converted before keep their new values.
+     * @since 1.1
+     **/
+    error_t read(QXmlStreamReader *reader, T *object) const;
+    /*}}}*/
+    // error_t load(QIODevice *device, T *object) const;/*{{{*/
+    /**
+     * Loads a structure from a device.
+     * @param device The device with the XML data. If it is not open it will
+     * be opened for reading.
+     * @param object The structure to fill.
+     * @return \b 0 (\c SSNO_ERROR) on success. \c SSE_FTYPE when the root
+     * element doesn't have the bound name. \c SSE_INVAL when a value cannot
+     * be converted to the type of its member. Otherwise an error code. See
+     * SSXMLDocument::open() for the possible values.
+     * @since 1.1
+     **/
+    error_t load(QIODevice *device, T *object) const;
+    /*}}}*/
+    // error_t load(const QByteArray &data, T *object) const;/*{{{*/
+    /**
+     * Loads a structure from memory.
+     * @param data The XML data.
+     * @param object The structure to fill.
+     * @return \b 0 (\c SSNO_ERROR) on success. \c SSE_FTYPE when the root
+     * element doesn't have the bound name. \c SSE_INVAL when a value cannot
+     * be converted to the type of its member. Otherwise an error code. See
+     * SSXMLDocument::open() for the possible values.
+     * @since 1.1
+     **/
+    error_t load(const QByteArray &data, T *object) const;
+    /*}}}*/
+
+protected:
+    /**
+     * A field of the binding.
+     * The base class skips the element it should read.
+     **/
+    struct Field
+    {
+        QString name;
+        explicit Field(const char *fieldName) : name(QLatin1String(fieldName)) { }
+        virtual ~Field() { }
+        virtual bool    assign(T *object, const QStringRef &value) const {
+            Q_UNUSED(object); Q_UNUSED(value); return false;
+        }
+        virtual error_t read(QXmlStreamReader *reader, T *object) const {
+            Q_UNUSED(object); reader->skipCurrentElement(); return SSNO_ERROR;
+        }
+    };
+
+    /**
+     * An attribute, text or simple element converted to a value.
+     **/
+    template <typename V>
+    struct ValueField : public Field
+    {
+        V T::*member;
+        bool (*converter)(const QStringRef&, V*);
+
+        ValueField(const char *fieldName, V T::*m, bool (*c)(const QStringRef&, V*)) :
+            Field(fieldName), member(m), converter(c) { }
+        virtual bool assign(T *object, const QStringRef &value) const {
+            return converter(value, &(object->*member));
+        }
+        virtual error_t read(QXmlStreamReader *reader, T *object) const {
+            QString value = reader->readElementText(QXmlStreamReader::SkipChildElements);
+            if (reader->hasError()) return readError(reader);
+            return (assign(object, QStringRef(&value).trimmed()) ? SSNO_ERROR : SSE_INVAL);
+        }
+    };
+
+    /**
+     * A child element bound to a member structure.
+     **/
+    template <typename V>
+    struct ChildField : public Field
+    {
+        V T::*member;
+        const SSXMLBinding<V> *binding;
+
+        ChildField(const char *fieldName, V T::*m, const SSXMLBinding<V> *b) :
+            Field(fieldName), member(m), binding(b) { }
+        virtual error_t read(QXmlStreamReader *reader, T *object) const {
+            return binding->read(reader, &(object->*member));
+        }
+    };
+
+    /**
+     * Repeated child elements bound to a list member.
+     **/
+    template <typename V>
+    struct ListField : public Field
+    {
+        QList<V> T::*member;
+        const SSXMLBinding<V> *binding;
+
+        ListField(const char *fieldName, QList<V> T::*m, const SSXMLBinding<V> *b) :
+            Field(fieldName), member(m), binding(b) { }
+        virtual error_t read(QXmlStreamReader *reader, T *object) const {
+            V item;
+            error_t result = binding->read(reader, &item);
+            if (result == SSNO_ERROR) (object->*member).append(item);
+            return result;
+        }
+    };
+
+    typedef QSharedPointer<const Field> FieldPtr;
+
+protected:      // Data Members
+    QString m_name;                     /**< Name of the bound element.     */
+    QList<FieldPtr> m_attributes;       /**< Bound attributes.              */
+    QList<FieldPtr> m_elements;         /**< Bound child elements.          */
+    FieldPtr m_text;                    /**< Bound text, if any.            */
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLBinding *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// template <typename T> inline SSXMLBinding<T>::SSXMLBinding(const char *elementName);/*{{{*/
+template <typename T>
+inline SSXMLBinding<T>::SSXMLBinding(const char *elementName) :
+    m_name(QLatin1String(elementName)) { }
+/*}}}*/
+// template <typename T> inline QString SSXMLBinding<T>::elementName() const;/*{{{*/
+template <typename T>
+inline QString SSXMLBinding<T>::elementName() const {
+    return m_name;
+}
+/*}}}*/
+// template <typename T> template <typename V> inline SSXMLBinding<T>& SSXMLBinding<T>::attribute(const char *name, V T::*member);/*{{{*/
+template <typename T> template <typename V>
+inline SSXMLBinding<T>& SSXMLBinding<T>::attribute(const char *name, V T::*member) {
+    return attribute(name, member, static_cast<bool (*)(const QStringRef&, V*)>(&SSXMLBindingBase::convert));
+}
+/*}}}*/
+// template <typename T> template <typename V> inline SSXMLBinding<T>& SSXMLBinding<T>::attribute(const char *name, V T::*member, bool (*converter)(const QStringRef&, V*));/*{{{*/
+template <typename T> template <typename V>
+inline SSXMLBinding<T>& SSXMLBinding<T>::attribute(const char *name, V T::*member, bool (*converter)(const QStringRef&, V*)) {
+    m_attributes.append(FieldPtr(new ValueField<V>(name, member, converter)));
+    return *this;
+}
+/*}}}*/
+// template <typename T> template <typename V> inline SSXMLBinding<T>& SSXMLBinding<T>::text(V T::*member);/*{{{*/
+template <typename T> template <typename V>
+inline SSXMLBinding<T>& SSXMLBinding<T>::text(V T::*member) {
+    m_text = FieldPtr(new ValueField<V>("", member, static_cast<bool (*)(const QStringRef&, V*)>(&SSXMLBindingBase::convert)));
+    return *this;
+}
+/*}}}*/
+// template <typename T> template <typename V> inline SSXMLBinding<T>& SSXMLBinding<T>::element(const char *name, V T::*member);/*{{{*/
+template <typename T> template <typename V>
+inline SSXMLBinding<T>& SSXMLBinding<T>::element(const char *name, V T::*member) {
+    m_elements.append(FieldPtr(new ValueField<V>(name, member, static_cast<bool (*)(const QStringRef&, V*)>(&SSXMLBindingBase::convert))));
+    return *this;
+}
+/*}}}*/
+// template <typename T> template <typename V> inline SSXMLBinding<T>& SSXMLBinding<T>::child(const char *name, V T::*member, const SSXMLBinding<V> *binding);/*{{{*/
+template <typename T> template <typename V>
+inline SSXMLBinding<T>& SSXMLBinding<T>::child(const char *name, V T::*member, const SSXMLBinding<V> *binding) {
+    m_elements.append(FieldPtr(new ChildField<V>(name, member, binding)));
+    return *this;
+}
+/*}}}*/
+// template <typename T> template <typename V> inline SSXMLBinding<T>& SSXMLBinding<T>::children(const char *name, QList<V> T::*member, const SSXMLBinding<V> *binding);/*{{{*/
+template <typename T> template <typename V>
+inline SSXMLBinding<T>& SSXMLBinding<T>::children(const char *name, QList<V> T::*member, const SSXMLBinding<V> *binding) {
+    m_elements.append(FieldPtr(new ListField<V>(name, member, binding)));
+    return *this;
+}
+/*}}}*/
+// template <typename T> error_t SSXMLBinding<T>::read(QXmlStreamReader *reader, T *object) const;/*{{{*/
+template <typename T>
+error_t SSXMLBinding<T>::read(QXmlStreamReader *reader, T *object) const
+{
+    size_t limit = m_attributes.count();
+
+    if (limit > 0)
+    {
+        QXmlStreamAttributes attributes = reader->attributes();
+        size_t count = attributes.count();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const QXmlStreamAttribute &attribute = attributes.at(i);
+
+            for (size_t f = 0; f < limit; ++f)
+            {
+                if (attribute.name() != m_attributes.at(f)->name)
+                    continue;
+
+                if (!m_attributes.at(f)->assign(object, attribute.value()))
+                    return SSE_INVAL;
+                break;
+            }
+        }
+    }
+
+    QString text;
+    error_t result;
+    const Field *field;
+
+    limit = m_elements.count();
+
+    forever
+    {
+        switch (reader->readNext())
+        {
+        case QXmlStreamReader::StartElement:
+            field = NULL;
+            for (size_t f = 0; (f < limit) && !field; ++f)
+            {
+                if (reader->name() == m_elements.at(f)->name)
+                    field = m_elements.at(f).data();
+            }
+
+            if (!field)
+                reader->skipCurrentElement();
+            else if ((result = field->read(reader, object)) != SSNO_ERROR)
+                return result;
+            break;
+        case QXmlStreamReader::Characters:
+            if (m_text && !reader->isWhitespace())
+                text.append(reader->text());
+            break;
+        case QXmlStreamReader::EndElement:
+            if (m_text && !text.isEmpty() && !m_text->assign(object, QStringRef(&text).trimmed()))
+                return SSE_INVAL;
+            return SSNO_ERROR;
+        case QXmlStreamReader::Invalid:
+        case QXmlStreamReader::EndDocument:
+            return readError(reader);
+        default:
+            break;
+        }
+    }
+}
+/*}}}*/
+// template <typename T> error_t SSXMLBinding<T>::load(QIODevice *device, T *object) const;/*{{{*/
+template <typename T>
+error_t SSXMLBinding<T>::load(QIODevice *device, T *object) const
+{
+    if (!device || !object) return SSE_INVAL;
+
+    bool opened = device->isOpen();
+    if (!opened && !device->open(QIODevice::ReadOnly))
+        return SSE_IO;
+
+    QXmlStreamReader reader(device);
+    error_t result;
+
+    if (!reader.readNextStartElement())
+        result = readError(&reader);
+    else if (reader.name() != m_name)
+        result = SSE_FTYPE;
+    else
+        result = read(&reader, object);
+
+    if (!opened) device->close();
+    return result;
+}
+/*}}}*/
+// template <typename T> error_t SSXMLBinding<T>::load(const QByteArray &data, T *object) const;/*{{{*/
+template <typename T>
+error_t SSXMLBinding<T>::load(const QByteArray &data, T *object) const
+{
+    if (!object) return SSE_INVAL;
+
+    QXmlStreamReader reader(data);
+
+    if (!reader.readNextStartElement())
+        return readError(&reader);
+
+    if (reader.name() != m_name)
+        return SSE_FTYPE;
+
+    return read(&reader, object);
+}
+/*}}}*/
+///@} SSXMLBinding /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLB_HPP_DEFINED__ */
@@ -0,0 +1,1318 @@
+/**
+ * \file
+ * Defines the SSXMLCompactDocument and SSXMLCompactElement classes.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmld.hpp"
+#include "ssqtxmlc.hpp"
+#include "ssqtgzip.hpp"
+
+/**
+ * @internal
+ * Values up to this length are stored only once in the string pool.
+ * Longer values are rarely repeated and hashing them while building the
+ * document is not worth.
+ **/
+#define SSXML_POOL_SHARED_LENGTH    32
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// template<typename T> static int __xml_intValue(const T &value, int defaultValue);/*{{{*/
+/**
+ * Converts an attribute value to \b int.
+ * @param value The value, as \c QStringRef or \c QByteArray.
+ * @param defaultValue Returned when \a value is not a number.
+ * @since 1.1
+ **/
+template<typename T> static int __xml_intValue(const T &value, int defaultValue);
+/*}}}*/
+// template<typename T> static bool __xml_boolValue(const T &value, bool defaultValue);/*{{{*/
+/**
+ * Converts an attribute value to \b bool.
+ * @param value The value, as \c QStringRef or \c QByteArray.
+ * @param defaultValue Returned when \a value is not a boolean.
+ * @since 1.1
+ **/
+template<typename T> static bool __xml_boolValue(const T &value, bool defaultValue);
+/*}}}*/
+
+/* ===========================================================================
+ * SSXMLCompactElement class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Attributes */ //@{
+/* ------------------------------------------------------------------------ */
+// QString SSXMLCompactElement::elementName() const;/*{{{*/
+QString SSXMLCompactElement::elementName() const
+{
+    if (!m_doc) return QString();
+    return m_doc->nameOf(m_doc->m_name.at(m_index));
+}
+/*}}}*/
+// QString SSXMLCompactElement::text() const;/*{{{*/
+QString SSXMLCompactElement::text() const
+{
+    if (!m_doc) return QString();
+    return m_doc->valueAt(m_doc->m_textPos.at(m_index), m_doc->m_textLen.at(m_index));
+}
+/*}}}*/
+// QByteArray SSXMLCompactElement::textUtf8() const;/*{{{*/
+QByteArray SSXMLCompactElement::textUtf8() const
+{
+    if (!m_doc) return QByteArray();
+    return m_doc->bytesAt(m_doc->m_textPos.at(m_index), m_doc->m_textLen.at(m_index));
+}
+/*}}}*/
+///@} Attributes
+
+/* ------------------------------------------------------------------------ */
+/*! \name Attributes Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// QString SSXMLCompactElement::attribute(const QString &attrName) const;/*{{{*/
+QString SSXMLCompactElement::attribute(const QString &attrName) const
+{
+    quint32 attr = findAttribute(attrName);
+    if (attr == SSXML_NPOS) return QString();
+
+    return m_doc->valueAt(m_doc->m_valuePos.at(attr), m_doc->m_valueLen.at(attr));
+}
+/*}}}*/
+// QStringRef SSXMLCompactElement::attributeRef(const QString &attrName) const;/*{{{*/
+QStringRef SSXMLCompactElement::attributeRef(const QString &attrName) const
+{
+    quint32 attr = findAttribute(attrName);
+    if ((attr == SSXML_NPOS) || (m_doc->m_storage != SSXML_STORE_UTF16))
+        return QStringRef();
+
+    return m_doc->stringAt(m_doc->m_valuePos.at(attr), m_doc->m_valueLen.at(attr));
+}
+/*}}}*/
+// QByteArray SSXMLCompactElement::attributeUtf8(const QString &attrName) const;/*{{{*/
+QByteArray SSXMLCompactElement::attributeUtf8(const QString &attrName) const
+{
+    quint32 attr = findAttribute(attrName);
+    if (attr == SSXML_NPOS) return QByteArray();
+
+    return m_doc->bytesAt(m_doc->m_valuePos.at(attr), m_doc->m_valueLen.at(attr));
+}
+/*}}}*/
+// int  SSXMLCompactElement::intValueOf(const QString &attrName, int defaultValue = 0) const;/*{{{*/
+int SSXMLCompactElement::intValueOf(const QString &attrName, int defaultValue) const
+{
+    if (m_doc && (m_doc->m_storage != SSXML_STORE_UTF16))
+        return __xml_intValue(attributeUtf8(attrName), defaultValue);
+
+    return __xml_intValue(attributeRef(attrName), defaultValue);
+}
+/*}}}*/
+// bool SSXMLCompactElement::boolValueOf(const QString &attrName, bool defaultValue = false) const;/*{{{*/
+bool SSXMLCompactElement::boolValueOf(const QString &attrName, bool defaultValue) const
+{
+    if (m_doc && (m_doc->m_storage != SSXML_STORE_UTF16))
+        return __xml_boolValue(attributeUtf8(attrName), defaultValue);
+
+    return __xml_boolValue(attributeRef(attrName), defaultValue);
+}
+/*}}}*/
+// QString SSXMLCompactElement::attributeName(uint index) const;/*{{{*/
+QString SSXMLCompactElement::attributeName(uint index) const
+{
+    if (index >= numberOfAttributes()) return QString();
+
+    quint32 attr = m_doc->m_attrs.at(m_index) + index;
+    return m_doc->nameOf(m_doc->m_attrName.at(attr));
+}
+/*}}}*/
+// QString SSXMLCompactElement::attributeValue(uint index) const;/*{{{*/
+QString SSXMLCompactElement::attributeValue(uint index) const
+{
+    if (index >= numberOfAttributes()) return QString();
+
+    quint32 attr = m_doc->m_attrs.at(m_index) + index;
+    return m_doc->valueAt(m_doc->m_valuePos.at(attr), m_doc->m_valueLen.at(attr));
+}
+/*}}}*/
+///@} Attributes Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Child Element Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// int SSXMLCompactElement::indexOf(const SSXMLCompactElement &element) const;/*{{{*/
+int SSXMLCompactElement::indexOf(const SSXMLCompactElement &element) const
+{
+    if (!m_doc || (element.m_doc != m_doc))
+        return -1;
+
+    if (m_doc->m_parent.at(element.m_index) != m_index)
+        return -1;
+
+    return (int)(element.m_index - m_doc->m_child.at(m_index));
+}
+/*}}}*/
+// SSXMLCompactElement SSXMLCompactElement::elementAt(uint index) const;/*{{{*/
+SSXMLCompactElement SSXMLCompactElement::elementAt(uint index) const
+{
+    if (index >= numberOfChildren()) return SSXMLCompactElement();
+    return SSXMLCompactElement(m_doc, m_doc->m_child.at(m_index) + index);
+}
+/*}}}*/
+///@} Child Element Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// quint32 SSXMLCompactElement::findAttribute(const QString &attrName) const;/*{{{*/
+quint32 SSXMLCompactElement::findAttribute(const QString &attrName) const
+{
+    if (!m_doc) return SSXML_NPOS;
+
+    quint32 nameID = m_doc->nameID(attrName);
+    if (nameID == SSXML_NPOS) return SSXML_NPOS;
+
+    quint32 limit = m_doc->m_attrs.at(m_index + 1);
+    for (quint32 i = m_doc->m_attrs.at(m_index); i < limit; ++i)
+    {
+        if (m_doc->m_attrName.at(i) == nameID)
+            return i;
+    }
+    return SSXML_NPOS;
+}
+/*}}}*/
+///@} Implementation
+
+/* ===========================================================================
+ * SSXMLCompactDocument class
+ * ======================================================================== */
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static quint32 __xml_internName(QString &pool, QHash<QString, quint32> &names, QVector<quint32> &namePos, QVector<quint32> &nameLen, const QString &name);/*{{{*/
+/**
+ * Gets the identifier of a name, adding it to the table when needed.
+ * @param pool The document string pool.
+ * @param names Map of names to identifiers.
+ * @param namePos Position of each name in the pool.
+ * @param nameLen Length of each name in the pool.
+ * @param name The name to look for.
+ * @returns The name identifier.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static quint32 __xml_internName(QString &pool, QHash<QString, quint32> &names, QVector<quint32> &namePos, QVector<quint32> &nameLen, const QString &name);
+/*}}}*/
+// static quint32 __xml_poolString(QString &pool, QHash<QString, quint32> &shared, const QString &value);/*{{{*/
+/**
+ * Puts a string in the document pool.
+ * @param pool The document string pool.
+ * @param shared Map of short strings already in the pool.
+ * @param value The string to add.
+ * @returns The position of the string in the pool. Short strings already in
+ * the pool are not added again.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static quint32 __xml_poolString(QString &pool, QHash<QString, quint32> &shared, const QString &value);
+/*}}}*/
+// static quint32 __xml_poolUtf8(QByteArray &pool, QHash<QString, quint32> &shared, const QString &value, quint32 *length);/*{{{*/
+/**
+ * Puts a string in the document UTF-8 pool.
+ * @param pool The document UTF-8 pool.
+ * @param shared Map of short strings already in the pool.
+ * @param value The string to add.
+ * @param length Receives the length of the string in the pool, in bytes.
+ * @returns The position of the string in the pool. Short strings already in
+ * the pool are not added again.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static quint32 __xml_poolUtf8(QByteArray &pool, QHash<QString, quint32> &shared, const QString &value, quint32 *length);
+/*}}}*/
+// static size_t __xml_vectorBytes(const QVector<quint32> &vector);/*{{{*/
+/**
+ * Heap memory used by an array of the compact document.
+ * @param vector The array.
+ * @returns The size of the array data block.
+ * @since 1.1
+ **/
+static size_t __xml_vectorBytes(const QVector<quint32> &vector);
+/*}}}*/
+
+/**
+ * @internal
+ * Elements found by __xml_scanRaw(), in document order.
+ * The vectors have one item for each element, except the attributes ones
+ * that have one item for each attribute. Names are identified by their
+ * position in #names, built from the raw bytes with no decoding.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+struct SSXMLRawTree
+{
+    QVector<quint32> name;              /**< Raw name id of each element.   */
+    QVector<quint32> parent;            /**< Parent of each element.        */
+    QVector<quint32> child;             /**< First child of each element.   */
+    QVector<quint32> next;              /**< Next sibling of each element.  */
+    QVector<quint32> count;             /**< Children count.                */
+    QVector<quint32> attrFirst;         /**< First attribute.               */
+    QVector<quint32> textPos;           /**< Content position in the data.  */
+    QVector<quint32> textLen;           /**< Content length and flag.       */
+    QVector<quint32> attrName;          /**< Raw name id of each attribute. */
+    QVector<quint32> valuePos;          /**< Value position in the data.    */
+    QVector<quint32> valueLen;          /**< Value length and flag.         */
+    QHash<QByteArray, quint32> ids;     /**< Raw names to ids.              */
+    QVector<QByteArray> names;          /**< Raw names by id.               */
+};
+
+// static error_t __xml_scanRaw(const QByteArray &data, SSXMLRawTree *tree, bool *supported);/*{{{*/
+/**
+ * Finds the elements, attributes and texts of an XML document.
+ * Nothing is decoded. Only the positions of names, values and texts in \a
+ * data are recorded.
+ * @param data The document, in UTF-8.
+ * @param tree Receives the elements.
+ * @param supported Set to \b false when the document can't be read this
+ * way: its encoding is not UTF-8 or it has an internal DTD subset. In this
+ * case the result is \c SSNO_ERROR and \a tree is incomplete.
+ * @returns \c SSNO_ERROR on success. \c SSE_FTYPE when the document is not
+ * well formed. \c SSE_IO when it ends before the root element is closed.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static error_t __xml_scanRaw(const QByteArray &data, SSXMLRawTree *tree, bool *supported);
+/*}}}*/
+// static quint32 __xml_rawName(SSXMLRawTree *tree, const char *name, int length);/*{{{*/
+/**
+ * Gets the identifier of a raw name, adding it when needed.
+ * @param tree The tree being built.
+ * @param name The name bytes. They must stay valid while \a tree is used.
+ * @param length Number of bytes in \a name.
+ * @returns The name identifier.
+ * @since 1.1
+ **/
+static quint32 __xml_rawName(SSXMLRawTree *tree, const char *name, int length);
+/*}}}*/
+// static QString __xml_decodeRaw(const char *data, int length, bool attribute);/*{{{*/
+/**
+ * Decodes a value or text as written in the source.
+ * Entity and character references are replaced and line breaks are
+ * normalized. Texts with comments, processing instructions or CDATA
+ * sections are passed to __xml_decodeMixed().
+ * @param data The raw bytes, in UTF-8.
+ * @param length Number of bytes.
+ * @param attribute \b true for attribute values. Their tabs and line breaks
+ * become spaces, as required for attributes.
+ * @returns The decoded string.
+ * @since 1.1
+ **/
+static QString __xml_decodeRaw(const char *data, int length, bool attribute);
+/*}}}*/
+// static QString __xml_decodeMixed(const char *data, int length);/*{{{*/
+/**
+ * Decodes a text with comments, processing instructions or CDATA sections.
+ * The text is read by \c QXmlStreamReader, the same way SSXMLDocument does.
+ * Each of those constructs ends a run of characters and only the last run
+ * is kept.
+ * @param data The raw bytes, in UTF-8.
+ * @param length Number of bytes.
+ * @returns The decoded text.
+ * @since 1.1
+ **/
+static QString __xml_decodeMixed(const char *data, int length);
+/*}}}*/
+// static void __xml_appendRaw(QByteArray *bytes, const char *p, const char *end, bool attribute);/*{{{*/
+/**
+ * Appends raw character data, normalizing line breaks.
+ * @param bytes The decoded bytes.
+ * @param p First byte to append.
+ * @param end Past the last byte to append.
+ * @param attribute \b true for attribute values.
+ * @since 1.1
+ **/
+static void __xml_appendRaw(QByteArray *bytes, const char *p, const char *end, bool attribute);
+/*}}}*/
+// static bool __xml_entity(const char *name, int length, uint *code);/*{{{*/
+/**
+ * Gets the character of an entity or character reference.
+ * @param name The reference, without \c & and \c ;.
+ * @param length Number of bytes in \a name.
+ * @param code Receives the Unicode code point.
+ * @returns \b false when the reference is not known.
+ * @since 1.1
+ **/
+static bool __xml_entity(const char *name, int length, uint *code);
+/*}}}*/
+// static bool __xml_knownEntities(const char *p, const char *end);/*{{{*/
+/**
+ * Checks whether all references in a range are known.
+ * @returns \b false when a reference is not one of the predefined entities
+ * or a valid character reference. \c QXmlStreamReader rejects them.
+ * @since 1.1
+ **/
+static bool __xml_knownEntities(const char *p, const char *end);
+/*}}}*/
+// static const char* __xml_search(const char *p, const char *end, const char *token);/*{{{*/
+/**
+ * Finds a sequence of characters.
+ * @param p Where to start.
+ * @param end Where to stop.
+ * @param token The characters to find.
+ * @returns The position of \a token or \b NULL when not found.
+ * @since 1.1
+ **/
+static const char* __xml_search(const char *p, const char *end, const char *token);
+/*}}}*/
+// static bool __xml_startsWith(const char *p, const char *end, const char *token);/*{{{*/
+/**
+ * Checks whether the data starts with a sequence of characters.
+ * @since 1.1
+ **/
+static bool __xml_startsWith(const char *p, const char *end, const char *token);
+/*}}}*/
+// static const char* __xml_skipSpace(const char *p, const char *end);/*{{{*/
+/**
+ * Skips white space.
+ * @returns The first character not a white space, or \a end.
+ * @since 1.1
+ **/
+static const char* __xml_skipSpace(const char *p, const char *end);
+/*}}}*/
+// static const char* __xml_nameEnd(const char *p, const char *end);/*{{{*/
+/**
+ * Finds the end of a name.
+ * @returns The first character after the name, or \a end.
+ * @since 1.1
+ **/
+static const char* __xml_nameEnd(const char *p, const char *end);
+/*}}}*/
+// static bool __xml_hasAny(const char *p, const char *end, const char *chars);/*{{{*/
+/**
+ * Checks whether a range has any of a set of characters.
+ * @since 1.1
+ **/
+static bool __xml_hasAny(const char *p, const char *end, const char *chars);
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/*! \name Attributes */ //@{
+/* ------------------------------------------------------------------------ */
+// size_t SSXMLCompactDocument::memoryUsage() const;/*{{{*/
+size_t SSXMLCompactDocument::memoryUsage() const
+{
+    SSXMLStatistics stats;
+
+    statistics(&stats);
+    return stats.totalBytes();
+}
+/*}}}*/
+// void SSXMLCompactDocument::statistics(SSXMLStatistics *stats) const;/*{{{*/
+void SSXMLCompactDocument::statistics(SSXMLStatistics *stats) const
+{
+    if (!stats) return;
+
+    stats->clear();
+    stats->elements   = m_name.size();
+    stats->attributes = m_attrName.size();
+
+    /* Elements are in breadth first order, so the last one is the deepest. */
+    for (quint32 i = (quint32)m_name.size() - 1; i != SSXML_NPOS; i = m_parent.at(i))
+        stats->maxDepth++;
+
+    /* The names are in the QString pool, and each is also a key of the
+     * names table. */
+    size_t chars = 0;
+    size_t limit = m_nameLen.size();
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        chars += m_nameLen.at(i);
+        stats->nameBytes += SSXMLStatistics::stringBytes((int)m_nameLen.at(i));
+    }
+    stats->nameBytes += chars * sizeof(QChar);
+
+    size_t poolBytes = ((size_t)(m_pool.length() - chars) * sizeof(QChar)) + (size_t)m_bytes.size();
+    size_t markup = 0;
+
+    stats->textBytes = m_textBytes;
+    if (m_storage != SSXML_STORE_LAZY)
+        stats->valueBytes = poolBytes - m_textBytes;
+    else
+    {
+        /* The pool is the source document. Only the ranges of values are
+         * values. Tags, names and other markup around them are overhead. */
+        limit = m_valueLen.size();
+        for (size_t i = 0; i < limit; ++i)
+            stats->valueBytes += (m_valueLen.at(i) & ~SSXML_RAW_ESCAPED);
+
+        markup = poolBytes - m_textBytes - stats->valueBytes;
+    }
+
+    stats->overheadBytes = sizeof(SSXMLCompactDocument) + markup;
+    stats->overheadBytes += __xml_vectorBytes(m_name) + __xml_vectorBytes(m_parent);
+    stats->overheadBytes += __xml_vectorBytes(m_child) + __xml_vectorBytes(m_next);
+    stats->overheadBytes += __xml_vectorBytes(m_count) + __xml_vectorBytes(m_attrs);
+    stats->overheadBytes += __xml_vectorBytes(m_textPos) + __xml_vectorBytes(m_textLen);
+    stats->overheadBytes += __xml_vectorBytes(m_attrName) + __xml_vectorBytes(m_valuePos);
+    stats->overheadBytes += __xml_vectorBytes(m_valueLen) + __xml_vectorBytes(m_namePos);
+    stats->overheadBytes += __xml_vectorBytes(m_nameLen);
+    stats->overheadBytes += SSXMLStatistics::hashBytes(m_names.count(), m_names.capacity());
+
+    /* Values already decoded by a lazy document. */
+    QHash<quint32, QString>::const_iterator it;
+
+    stats->overheadBytes += SSXMLStatistics::hashBytes(m_decoded.count(), m_decoded.capacity());
+    for (it = m_decoded.constBegin(); it != m_decoded.constEnd(); ++it)
+        stats->overheadBytes += SSXMLStatistics::stringBytes(it.value().length());
+
+    /* Headers and terminators of the pools. */
+    if (!m_pool.isEmpty()) stats->overheadBytes += sizeof(QArrayData) + sizeof(QChar);
+    if (!m_bytes.isEmpty()) stats->overheadBytes += sizeof(QArrayData) + 1;
+}
+/*}}}*/
+///@} Attributes
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLCompactDocument::assign(const SSXMLElement *root, uint storage = SSXML_STORE_UTF16);/*{{{*/
+error_t SSXMLCompactDocument::assign(const SSXMLElement *root, uint storage)
+{
+    if (!root || (storage > SSXML_STORE_UTF8)) return SSE_INVAL;
+
+    clear();
+    m_storage = storage;
+
+    /* First pass: lists the elements in breadth first order. This way the
+     * children of each element are placed side by side.
+     */
+    QVector<const SSXMLElement*> order;
+    const SSXMLElement *node;
+    size_t limit, attrCount = 0;
+
+    order.append(root);
+    for (int i = 0; i < order.size(); ++i)
+    {
+        node  = order.at(i);
+        limit = node->numberOfChildren();
+        attrCount += node->numberOfAttributes();
+
+        for (size_t c = 0; c < limit; ++c)
+            order.append(node->elementAt((uint)c));
+
+        if ((size_t)order.size() >= SSXML_NPOS)
+            return SSE_OVERFLOW;
+    }
+
+    /* Second pass: fills the arrays. */
+    QHash<QString, quint32> shared;
+    quint32 count = (quint32)order.size();
+    quint32 next  = 1;
+    quint32 attrIndex = 0;
+
+    m_name.resize(count);
+    m_parent.fill(SSXML_NPOS, count);
+    m_child.fill(SSXML_NPOS, count);
+    m_next.fill(SSXML_NPOS, count);
+    m_count.resize(count);
+    m_attrs.resize(count + 1);
+    m_textPos.resize(count);
+    m_textLen.resize(count);
+    m_attrName.resize((int)attrCount);
+    m_valuePos.resize((int)attrCount);
+    m_valueLen.resize((int)attrCount);
+
+    for (quint32 i = 0; i < count; ++i)
+    {
+        node  = order.at(i);
+        limit = node->numberOfChildren();
+
+        m_name[i]  = __xml_internName(m_pool, m_names, m_namePos, m_nameLen, node->elementName);
+        m_count[i] = (quint32)limit;
+        m_attrs[i] = attrIndex;
+
+        if (limit > 0)
+        {
+            m_child[i] = next;
+            for (quint32 c = 0; c < limit; ++c)
+            {
+                m_parent[next + c] = i;
+                if ((c + 1) < limit)
+                    m_next[next + c] = (next + c + 1);
+            }
+            next += (quint32)limit;
+        }
+
+        const QHash<QString, QString> &attrs = node->attributes();
+        QHash<QString, QString>::const_iterator it = attrs.cbegin();
+
+        while (it != attrs.cend())
+        {
+            m_attrName[attrIndex] = __xml_internName(m_pool, m_names, m_namePos, m_nameLen, it.key());
+
+            if (m_storage == SSXML_STORE_UTF8)
+                m_valuePos[attrIndex] = __xml_poolUtf8(m_bytes, shared, it.value(), &m_valueLen[attrIndex]);
+            else
+            {
+                m_valuePos[attrIndex] = __xml_poolString(m_pool, shared, it.value());
+                m_valueLen[attrIndex] = (quint32)it.value().length();
+            }
+            ++attrIndex;
+            ++it;
+        }
+
+        /* Names go only to the QString pool, so the growth of the pool
+         * that keeps the values is the text stored. */
+        QString text = node->text();
+        size_t before = ((m_storage == SSXML_STORE_UTF8) ? (size_t)m_bytes.size() : (size_t)m_pool.length() * sizeof(QChar));
+
+        if (m_storage == SSXML_STORE_UTF8)
+        {
+            m_textPos[i] = __xml_poolUtf8(m_bytes, shared, text, &m_textLen[i]);
+            m_textBytes += ((size_t)m_bytes.size() - before);
+        }
+        else
+        {
+            m_textPos[i] = __xml_poolString(m_pool, shared, text);
+            m_textLen[i] = (quint32)text.length();
+            m_textBytes += (((size_t)m_pool.length() * sizeof(QChar)) - before);
+        }
+    }
+    m_attrs[count] = attrIndex;
+    m_pool.squeeze();
+    m_bytes.squeeze();
+
+    return SSNO_ERROR;
+}
+/*}}}*/
+// void SSXMLCompactDocument::clear();/*{{{*/
+void SSXMLCompactDocument::clear()
+{
+    m_name.clear();
+    m_parent.clear();
+    m_child.clear();
+    m_next.clear();
+    m_count.clear();
+    m_attrs.clear();
+    m_textPos.clear();
+    m_textLen.clear();
+    m_attrName.clear();
+    m_valuePos.clear();
+    m_valueLen.clear();
+    m_namePos.clear();
+    m_nameLen.clear();
+    m_names.clear();
+    m_pool.clear();
+    m_bytes.clear();
+    m_decoded.clear();
+    m_textBytes = 0;
+}
+/*}}}*/
+// error_t SSXMLCompactDocument::load(const QByteArray &data);/*{{{*/
+error_t SSXMLCompactDocument::load(const QByteArray &data)
+{
+    if (SSGZipDevice::isCompressed(data))
+    {
+        QBuffer buffer(const_cast<QByteArray*>(&data));
+        SSGZipDevice zip(&buffer);
+
+        if (!buffer.open(QIODevice::ReadOnly) || !zip.open(QIODevice::ReadOnly))
+            return SSE_IO;
+
+        return load(zip.readAll());
+    }
+
+    SSXMLRawTree tree;
+    bool supported = true;
+    error_t result = __xml_scanRaw(data, &tree, &supported);
+
+    if (result != SSNO_ERROR)
+        return result;
+
+    if (!supported)
+    {
+        SSXMLDocument document;
+
+        result = document.open(data);
+        if (result == SSNO_ERROR)
+            result = assign(&document, SSXML_STORE_UTF8);
+
+        return result;
+    }
+
+    clear();
+    m_storage = SSXML_STORE_LAZY;
+    m_bytes   = data;                   /* Shared. Nothing is copied. */
+
+    /* Each distinct name is decoded once. */
+    size_t limit = tree.names.count();
+    QVector<quint32> names((int)limit);
+
+    for (size_t i = 0; i < limit; ++i)
+        names[i] = __xml_internName(m_pool, m_names, m_namePos, m_nameLen, QString::fromUtf8(tree.names.at(i)));
+
+    /* Elements were found in document order. They are placed in breadth
+     * first order so the children of each element are side by side. */
+    quint32 count = (quint32)tree.name.size();
+    QVector<quint32> order;
+    QVector<quint32> position((int)count);
+
+    order.reserve((int)count);
+    order.append(0);
+
+    for (int i = 0; i < order.size(); ++i)
+    {
+        position[order.at(i)] = (quint32)i;
+        for (quint32 c = tree.child.at(order.at(i)); c != SSXML_NPOS; c = tree.next.at(c))
+            order.append(c);
+    }
+
+    quint32 attrCount = (quint32)tree.attrName.size();
+    quint32 attrIndex = 0;
+
+    m_name.resize(count);
+    m_parent.resize(count);
+    m_child.resize(count);
+    m_next.resize(count);
+    m_count.resize(count);
+    m_attrs.resize(count + 1);
+    m_textPos.resize(count);
+    m_textLen.resize(count);
+    m_attrName.resize(attrCount);
+    m_valuePos.resize(attrCount);
+    m_valueLen.resize(attrCount);
+
+    for (quint32 i = 0; i < count; ++i)
+    {
+        quint32 raw  = order.at(i);
+        quint32 link;
+
+        m_name[i]  = names.at(tree.name.at(raw));
+        m_count[i] = tree.count.at(raw);
+        m_attrs[i] = attrIndex;
+
+        link = tree.parent.at(raw);
+        m_parent[i] = ((link == SSXML_NPOS) ? SSXML_NPOS : position.at(link));
+        link = tree.child.at(raw);
+        m_child[i]  = ((link == SSXML_NPOS) ? SSXML_NPOS : position.at(link));
+        link = tree.next.at(raw);
+        m_next[i]   = ((link == SSXML_NPOS) ? SSXML_NPOS : position.at(link));
+
+        m_textPos[i] = tree.textPos.at(raw);
+        m_textLen[i] = tree.textLen.at(raw);
+        m_textBytes += (m_textLen.at(i) & ~SSXML_RAW_ESCAPED);
+
+        quint32 last = (((raw + 1) < count) ? tree.attrFirst.at(raw + 1) : attrCount);
+        for (quint32 a = tree.attrFirst.at(raw); a < last; ++a, ++attrIndex)
+        {
+            m_attrName[attrIndex] = names.at(tree.attrName.at(a));
+            m_valuePos[attrIndex] = tree.valuePos.at(a);
+            m_valueLen[attrIndex] = tree.valueLen.at(a);
+        }
+    }
+    m_attrs[count] = attrIndex;
+    m_pool.squeeze();
+
+    return SSNO_ERROR;
+}
+/*}}}*/
+// error_t SSXMLCompactDocument::load(const QString &fileName);/*{{{*/
+error_t SSXMLCompactDocument::load(const QString &fileName)
+{
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        sstrace("Error: '%s'", SST(file.errorString()));
+        return SSE_IO;
+    }
+
+    QByteArray data = file.readAll();
+    file.close();
+
+    return load(data);
+}
+/*}}}*/
+// QString SSXMLCompactDocument::nameOf(quint32 nameID) const;/*{{{*/
+QString SSXMLCompactDocument::nameOf(quint32 nameID) const
+{
+    if (nameID >= (quint32)m_namePos.size()) return QString();
+    return stringAt(m_namePos.at(nameID), m_nameLen.at(nameID)).toString();
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// QString SSXMLCompactDocument::decode(quint32 pos, quint32 length) const;/*{{{*/
+/**
+ * Decodes a value or text of a lazy document.
+ * @param pos Position of the value in the source.
+ * @param length Length of the value, with the \c SSXML_RAW_ESCAPED flag.
+ * @returns The decoded value. It is cached, so each value is decoded once.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+QString SSXMLCompactDocument::decode(quint32 pos, quint32 length) const
+{
+    QHash<quint32, QString>::const_iterator it = m_decoded.constFind(pos);
+    if (it != m_decoded.cend())
+        return it.value();
+
+    /* Texts start right after the '>' of their start tag. Values start
+     * after their quote. */
+    bool attribute = ((pos > 0) && (m_bytes.at((int)pos - 1) != '>'));
+    QString value  = __xml_decodeRaw(m_bytes.constData() + pos, (int)(length & ~SSXML_RAW_ESCAPED), attribute);
+
+    m_decoded.insert(pos, value);
+    return value;
+}
+/*}}}*/
+///@} Implementation
+
+// static quint32 __xml_internName(QString &pool, QHash<QString, quint32> &names, QVector<quint32> &namePos, QVector<quint32> &nameLen, const QString &name);/*{{{*/
+static quint32 __xml_internName(QString &pool, QHash<QString, quint32> &names, QVector<quint32> &namePos, QVector<quint32> &nameLen, const QString &name)
+{
+    QHash<QString, quint32>::const_iterator it = names.constFind(name);
+    if (it != names.cend())
+        return it.value();
+
+    quint32 nameID = (quint32)namePos.size();
+
+    namePos.append((quint32)pool.length());
+    nameLen.append((quint32)name.length());
+    pool.append(name);
+    names.insert(name, nameID);
+
+    return nameID;
+}
+/*}}}*/
+// static quint32 __xml_poolString(QString &pool, QHash<QString, quint32> &shared, const QString &value);/*{{{*/
+static quint32 __xml_poolString(QString &pool, QHash<QString, quint32> &shared, const QString &value)
+{
+    if (value.isEmpty()) return 0;
+
+    quint32 pos = (quint32)pool.length();
+
+    if (value.length() <= SSXML_POOL_SHARED_LENGTH)
+    {
+        QHash<QString, quint32>::const_iterator it = shared.constFind(value);
+        if (it != shared.cend())
+            return it.value();
+
+        shared.insert(value, pos);
+    }
+    pool.append(value);
+    return pos;
+}
+/*}}}*/
+// static quint32 __xml_poolUtf8(QByteArray &pool, QHash<QString, quint32> &shared, const QString &value, quint32 *length);/*{{{*/
+static quint32 __xml_poolUtf8(QByteArray &pool, QHash<QString, quint32> &shared, const QString &value, quint32 *length)
+{
+    *length = 0;
+    if (value.isEmpty()) return 0;
+
+    QByteArray bytes = value.toUtf8();
+    quint32 pos = (quint32)pool.size();
+
+    *length = (quint32)bytes.size();
+
+    if (value.length() <= SSXML_POOL_SHARED_LENGTH)
+    {
+        QHash<QString, quint32>::const_iterator it = shared.constFind(value);
+        if (it != shared.cend())
+            return it.value();
+
+        shared.insert(value, pos);
+    }
+    pool.append(bytes);
+    return pos;
+}
+/*}}}*/
+// static size_t __xml_vectorBytes(const QVector<quint32> &vector);/*{{{*/
+static size_t __xml_vectorBytes(const QVector<quint32> &vector)
+{
+    if (vector.capacity() == 0) return 0;
+    return (sizeof(QArrayData) + (size_t)vector.capacity() * sizeof(quint32));
+}
+/*}}}*/
+// template<typename T> static int __xml_intValue(const T &value, int defaultValue);/*{{{*/
+template<typename T> static int __xml_intValue(const T &value, int defaultValue)
+{
+    bool success = true;
+    int  result  = value.toInt(&success, 0);
+
+    return (success ? result : defaultValue);
+}
+/*}}}*/
+// template<typename T> static bool __xml_boolValue(const T &value, bool defaultValue);/*{{{*/
+template<typename T> static bool __xml_boolValue(const T &value, bool defaultValue)
+{
+    bool result = defaultValue;
+
+    if ((value == "true") || (value == "yes") || (value.toInt() != 0))
+        result = true;
+    else if ((value == "false") || (value == "no") || (value.toInt() == 0))
+        result = false;
+
+    return result;
+}
+/*}}}*/
+// static error_t __xml_scanRaw(const QByteArray &data, SSXMLRawTree *tree, bool *supported);/*{{{*/
+static error_t __xml_scanRaw(const QByteArray &data, SSXMLRawTree *tree, bool *supported)
+{
+    const char *base = data.constData();
+    const char *end  = base + data.size();
+    const char *p    = base;
+    QVector<quint32> open;              /* Elements not closed yet.     */
+    QVector<quint32> last;              /* Last child of each of them.  */
+
+    *supported = true;
+
+    if (__xml_startsWith(p, end, "\xEF\xBB\xBF"))
+        p += 3;
+    else if (((end - p) >= 2) && ((p[0] == '\0') || (p[1] == '\0') || ((uchar)p[0] >= 0xFE)))
+    {
+        *supported = false;             /* UTF-16 or UTF-32. */
+        return SSNO_ERROR;
+    }
+
+    const char *start = p;
+
+    while (p < end)
+    {
+        if (*p != '<')
+        {
+            const char *text = p;
+
+            p = (const char*)memchr(p, '<', end - p);
+            if (p == NULL) p = end;
+
+            if (open.isEmpty())
+            {
+                if (__xml_skipSpace(text, p) != p) return SSE_FTYPE;
+            }
+            else if (__xml_hasAny(text, p, "&\r"))
+            {
+                if (!__xml_knownEntities(text, p))
+                {
+                    *supported = false;     /* SSXMLDocument rejects it. */
+                    return SSNO_ERROR;
+                }
+                tree->textLen[open.last()] |= SSXML_RAW_ESCAPED;
+            }
+
+            continue;
+        }
+
+        if (__xml_startsWith(p, end, "<?"))
+        {
+            const char *close = __xml_search(p + 2, end, "?>");
+            if (close == NULL) return SSE_IO;
+
+            if ((p == start) && __xml_startsWith(p, end, "<?xml "))
+            {
+                const char *encoding = __xml_search(p, close, "encoding");
+                if (encoding != NULL)
+                {
+                    const char *q = __xml_skipSpace(encoding + 8, close);
+                    if ((q < close) && (*q == '=')) q = __xml_skipSpace(q + 1, close);
+
+                    const char *e = (((q < close) && ((*q == '"') || (*q == '\''))) ? (const char*)memchr(q + 1, *q, close - q - 1) : NULL);
+                    if (e == NULL) return SSE_FTYPE;
+
+                    QByteArray name = QByteArray(q + 1, (int)(e - q - 1)).toLower();
+                    if ((name != "utf-8") && (name != "utf8") && (name != "us-ascii") && (name != "ascii"))
+                    {
+                        *supported = false;
+                        return SSNO_ERROR;
+                    }
+                }
+            }
+            else if (!open.isEmpty())
+                tree->textLen[open.last()] |= SSXML_RAW_ESCAPED;
+
+            p = close + 2;
+            continue;
+        }
+
+        if (__xml_startsWith(p, end, "<!--"))
+        {
+            const char *close = __xml_search(p + 4, end, "-->");
+            if (close == NULL) return SSE_IO;
+
+            if (!open.isEmpty())
+                tree->textLen[open.last()] |= SSXML_RAW_ESCAPED;
+
+            p = close + 3;
+            continue;
+        }
+
+        if (__xml_startsWith(p, end, "<![CDATA["))
+        {
+            if (open.isEmpty()) return SSE_FTYPE;
+
+            const char *close = __xml_search(p + 9, end, "]]>");
+            if (close == NULL) return SSE_IO;
+
+            tree->textLen[open.last()] |= SSXML_RAW_ESCAPED;
+            p = close + 3;
+            continue;
+        }
+
+        if (__xml_startsWith(p, end, "<!"))
+        {
+            /* Document type declaration. Entities declared in an internal
+             * subset can't be decoded later. */
+            if (!open.isEmpty() || !tree->name.isEmpty()) return SSE_FTYPE;
+
+            const char *close = (const char*)memchr(p, '>', end - p);
+            if (close == NULL) return SSE_IO;
+
+            if (memchr(p, '[', close - p) != NULL)
+            {
+                *supported = false;
+                return SSNO_ERROR;
+            }
+            p = close + 1;
+            continue;
+        }
+
+        if (__xml_startsWith(p, end, "</"))
+        {
+            if (open.isEmpty()) return SSE_FTYPE;
+
+            quint32 current  = open.last();
+            const char *name = p + 2;
+            const char *q    = __xml_nameEnd(name, end);
+            const QByteArray &expected = tree->names.at(tree->name.at(current));
+
+            if (((q - name) != expected.size()) || (memcmp(name, expected.constData(), expected.size()) != 0))
+                return SSE_FTYPE;
+
+            q = __xml_skipSpace(q, end);
+            if (q >= end) return SSE_IO;
+            if (*q != '>') return SSE_FTYPE;
+
+            /* Children have priority over text. */
+            if (tree->count.at(current) > 0)
+                tree->textPos[current] = tree->textLen[current] = 0;
+            else
+                tree->textLen[current] |= (quint32)((p - base) - tree->textPos.at(current));
+
+            open.pop_back();
+            last.pop_back();
+            p = q + 1;
+            continue;
+        }
+
+        /* Start tag. */
+        if (open.isEmpty() && !tree->name.isEmpty()) return SSE_FTYPE;
+
+        const char *name = p + 1;
+        const char *q    = __xml_nameEnd(name, end);
+        quint32 index    = (quint32)tree->name.size();
+
+        if (q == name) return SSE_FTYPE;
+
+        tree->name.append(__xml_rawName(tree, name, (int)(q - name)));
+        tree->parent.append(open.isEmpty() ? SSXML_NPOS : open.last());
+        tree->child.append(SSXML_NPOS);
+        tree->next.append(SSXML_NPOS);
+        tree->count.append(0);
+        tree->attrFirst.append((quint32)tree->attrName.size());
+        tree->textPos.append(0);
+        tree->textLen.append(0);
+
+        if (!open.isEmpty())
+        {
+            quint32 parent = open.last();
+
+            if (last.last() == SSXML_NPOS)
+                tree->child[parent] = index;
+            else
+                tree->next[last.last()] = index;
+
+            tree->count[parent]++;
+            last.last() = index;
+        }
+
+        bool empty = false;
+        for (;;)
+        {
+            const char *space = q;
+
+            q = __xml_skipSpace(q, end);
+            if (q >= end) return SSE_IO;
+
+            if (*q == '>')
+            {
+                ++q;
+                break;
+            }
+
+            if (*q == '/')
+            {
+                if ((q + 1) >= end) return SSE_IO;
+                if (q[1] != '>') return SSE_FTYPE;
+
+                q += 2;
+                empty = true;
+                break;
+            }
+
+            if (q == space) return SSE_FTYPE;   /* Attributes need a space. */
+
+            const char *attr = q;
+            q = __xml_nameEnd(q, end);
+            if (q == attr) return SSE_FTYPE;
+
+            quint32 attrName = __xml_rawName(tree, attr, (int)(q - attr));
+
+            q = __xml_skipSpace(q, end);
+            if ((q >= end) || (*q != '=')) return ((q >= end) ? SSE_IO : SSE_FTYPE);
+
+            q = __xml_skipSpace(q + 1, end);
+            if (q >= end) return SSE_IO;
+            if ((*q != '"') && (*q != '\'')) return SSE_FTYPE;
+
+            const char *value = q + 1;
+            q = (const char*)memchr(value, *q, end - value);
+            if (q == NULL) return SSE_IO;
+            if (memchr(value, '<', q - value) != NULL) return SSE_FTYPE;
+
+            quint32 length = (quint32)(q - value);
+            if (__xml_hasAny(value, q, "&\t\n\r"))
+                length |= SSXML_RAW_ESCAPED;
+
+            if (!__xml_knownEntities(value, q))
+            {
+                *supported = false;         /* SSXMLDocument rejects it. */
+                return SSNO_ERROR;
+            }
+
+            tree->attrName.append(attrName);
+            tree->valuePos.append((quint32)(value - base));
+            tree->valueLen.append(length);
+            ++q;
+        }
+
+        if (!empty)
+        {
+            tree->textPos[index] = (quint32)(q - base);
+            open.append(index);
+            last.append(SSXML_NPOS);
+        }
+        p = q;
+    }
+
+    if (!open.isEmpty() || tree->name.isEmpty())
+        return SSE_IO;
+
+    return SSNO_ERROR;
+}
+/*}}}*/
+// static quint32 __xml_rawName(SSXMLRawTree *tree, const char *name, int length);/*{{{*/
+static quint32 __xml_rawName(SSXMLRawTree *tree, const char *name, int length)
+{
+    QByteArray key = QByteArray::fromRawData(name, length);
+    QHash<QByteArray, quint32>::const_iterator it = tree->ids.constFind(key);
+
+    if (it != tree->ids.cend())
+        return it.value();
+
+    quint32 id = (quint32)tree->names.size();
+
+    tree->names.append(key);
+    tree->ids.insert(key, id);
+    return id;
+}
+/*}}}*/
+// static QString __xml_decodeRaw(const char *data, int length, bool attribute);/*{{{*/
+static QString __xml_decodeRaw(const char *data, int length, bool attribute)
+{
+    const char *p   = data;
+    const char *end = data + length;
+    QByteArray bytes;
+
+    /* Attribute values never have '<'. */
+    if (!attribute && (memchr(data, '<', length) != NULL))
+        return __xml_decodeMixed(data, length);
+
+    bytes.reserve(length);
+
+    while (p < end)
+    {
+        const char *special = (const char*)memchr(p, '&', end - p);
+        if (special == NULL) special = end;
+
+        __xml_appendRaw(&bytes, p, special, attribute);
+        p = special;
+        if (p >= end) break;
+
+        /* Unknown references were sent to SSXMLDocument by the scan. */
+        const char *semi = (const char*)memchr(p, ';', end - p);
+        uint code = 0;
+
+        if ((semi != NULL) && __xml_entity(p + 1, (int)(semi - p - 1), &code))
+        {
+            bytes.append(QString::fromUcs4(&code, 1).toUtf8());
+            p = semi + 1;
+        }
+        else
+        {
+            bytes.append('&');
+            ++p;
+        }
+    }
+    return QString::fromUtf8(bytes);
+}
+/*}}}*/
+// static QString __xml_decodeMixed(const char *data, int length);/*{{{*/
+static QString __xml_decodeMixed(const char *data, int length)
+{
+    QByteArray xml;
+    QString text;
+
+    xml.reserve(length + 7);
+    xml.append("<x>").append(data, length).append("</x>");
+
+    QXmlStreamReader reader(xml);
+
+    /* The same loop of SSXMLDocument: every run replaces the text. */
+    while (!reader.atEnd())
+    {
+        if (reader.readNext() == QXmlStreamReader::Characters)
+            text = reader.text().toString();
+    }
+    return text;
+}
+/*}}}*/
+// static void __xml_appendRaw(QByteArray *bytes, const char *p, const char *end, bool attribute);/*{{{*/
+static void __xml_appendRaw(QByteArray *bytes, const char *p, const char *end, bool attribute)
+{
+    for (; p < end; ++p)
+    {
+        char c = *p;
+
+        if (c == '\r')
+        {
+            if (((p + 1) < end) && (p[1] == '\n')) ++p;
+            c = '\n';
+        }
+
+        if (attribute && ((c == '\n') || (c == '\t')))
+            c = ' ';
+
+        bytes->append(c);
+    }
+}
+/*}}}*/
+// static bool __xml_entity(const char *name, int length, uint *code);/*{{{*/
+static bool __xml_entity(const char *name, int length, uint *code)
+{
+    QByteArray entity = QByteArray::fromRawData(name, length);
+    bool success = true;
+
+    if (entity == "lt")
+        *code = '<';
+    else if (entity == "gt")
+        *code = '>';
+    else if (entity == "amp")
+        *code = '&';
+    else if (entity == "quot")
+        *code = '"';
+    else if (entity == "apos")
+        *code = '\'';
+    else if (entity.startsWith("#x"))
+        *code = entity.mid(2).toUInt(&success, 16);
+    else if (entity.startsWith('#'))
+        *code = entity.mid(1).toUInt(&success, 10);
+    else
+        success = false;
+
+    if (!success) return false;
+
+    /* The characters allowed by XML, as checked by QXmlStreamReader. */
+    uint c = *code;
+    return ((c == 0x09) || (c == 0x0A) || (c == 0x0D) || ((c >= 0x20) && (c <= 0xD7FF)) ||
+            ((c >= 0xE000) && (c <= 0xFFFD)) || ((c >= 0x10000) && (c <= 0x10FFFF)));
+}
+/*}}}*/
+// static bool __xml_knownEntities(const char *p, const char *end);/*{{{*/
+static bool __xml_knownEntities(const char *p, const char *end)
+{
+    uint code = 0;
+
+    while ((p = (const char*)memchr(p, '&', end - p)) != NULL)
+    {
+        const char *semi = (const char*)memchr(p, ';', end - p);
+
+        if ((semi == NULL) || !__xml_entity(p + 1, (int)(semi - p - 1), &code))
+            return false;
+
+        p = semi + 1;
+    }
+    return true;
+}
+/*}}}*/
+// static const char* __xml_search(const char *p, const char *end, const char *token);/*{{{*/
+static const char* __xml_search(const char *p, const char *end, const char *token)
+{
+    size_t length = strlen(token);
+
+    while ((p < end) && ((size_t)(end - p) >= length))
+    {
+        p = (const char*)memchr(p, token[0], (end - p) - length + 1);
+        if (p == NULL) return NULL;
+        if (memcmp(p, token, length) == 0) return p;
+        ++p;
+    }
+    return NULL;
+}
+/*}}}*/
+// static bool __xml_startsWith(const char *p, const char *end, const char *token);/*{{{*/
+static bool __xml_startsWith(const char *p, const char *end, const char *token)
+{
+    size_t length = strlen(token);
+    return (((size_t)(end - p) >= length) && (memcmp(p, token, length) == 0));
+}
+/*}}}*/
+// static const char* __xml_skipSpace(const char *p, const char *end);/*{{{*/
+static const char* __xml_skipSpace(const char *p, const char *end)
+{
+    while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\n') || (*p == '\r')))
+        ++p;
+    return p;
+}
+/*}}}*/
+// static const char* __xml_nameEnd(const char *p, const char *end);/*{{{*/
+static const char* __xml_nameEnd(const char *p, const char *end)
+{
+    while ((p < end) && !strchr(" \t\n\r/>=", *p))
+        ++p;
+    return p;
+}
+/*}}}*/
+// static bool __xml_hasAny(const char *p, const char *end, const char *chars);/*{{{*/
+static bool __xml_hasAny(const char *p, const char *end, const char *chars)
+{
+    for (; p < end; ++p)
+    {
+        if (strchr(chars, *p)) return true;
+    }
+    return false;
+}
+/*}}}*/
+
@@ -0,0 +1,788 @@
+/**
+ * \file
+ * Declares the SSXMLCompactDocument and SSXMLCompactElement classes.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLC_HPP_DEFINED__
+#define __SSQTXMLC_HPP_DEFINED__
+
+#include <QString>
+#include <QStringRef>
+#include <QByteArray>
+#include <QVector>
+#include <QHash>
+#include "ssqtcmn.hpp"
+
+/**
+ * @internal
+ * Forward declarations.
+ * @{ *//* ---------------------------------------------------------------- */
+class SSXMLElement;
+class SSXMLCompactDocument;
+struct SSXMLStatistics;
+///@} internal
+
+/**
+ * \ingroup ssqt_xml
+ * Invalid index in a compact document.
+ * Used as the value of parent, child and sibling links that doesn't point to
+ * any element. Also returned by SSXMLCompactDocument::nameID() when a name is
+ * not used in the document.
+ * @since 1.1
+ **/
+#define SSXML_NPOS          0xFFFFFFFFU
+
+/**
+ * \ingroup ssqt_xml
+ * How SSXMLCompactDocument stores attributes values and texts.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_STORE_UTF16   0       /**< \c QString pool. The default.      */
+#define SSXML_STORE_UTF8    1       /**< UTF-8 bytes pool.                  */
+#define SSXML_STORE_LAZY    2       /**< Source bytes, decoded when read.   */
+///@}
+
+/**
+ * @internal
+ * Set in the length of values and texts of lazy documents that have entity
+ * references, markup or line breaks to be decoded.
+ **/
+#define SSXML_RAW_ESCAPED   0x80000000U
+
+/**
+ * @ingroup ssqt_xml
+ * A read only reference to an element of a compact document.
+ * This is a very light object, having only a pointer to the document and the
+ * index of the element in it. It can be copied by value freely. Its public
+ * interface mimics the read operations of \c SSXMLElement so code written to
+ * read configuration can be easily changed to work with compact documents.
+ * @note An instance of this class is valid only while the document it refers
+ * to is alive and unchanged.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLCompactElement
+{
+public:
+    SSXMLCompactElement();
+    SSXMLCompactElement(const SSXMLCompactDocument *document, quint32 index);
+
+public:         // Attributes
+    // bool isNull() const;/*{{{*/
+    /**
+     * Checks whether this object references a valid element.
+     * @returns \b true when this object doesn't reference any element.
+     * Operations that return children or parent elements return \e null
+     * objects when the requested element doesn't exist.
+     * @since 1.1
+     **/
+    bool isNull() const;
+    /*}}}*/
+    // quint32 index() const;/*{{{*/
+    /**
+     * Index of this element in its document.
+     * @returns The zero based index of this element in the document or \c
+     * SSXML_NPOS when this is a \e null object.
+     * @since 1.1
+     **/
+    quint32 index() const;
+    /*}}}*/
+    // QString elementName() const;/*{{{*/
+    /**
+     * Name of this element.
+     * @returns A \c QString with the element's tag name.
+     * @since 1.1
+     **/
+    QString elementName() const;
+    /*}}}*/
+    // SSXMLCompactElement parentElement() const;/*{{{*/
+    /**
+     * Parent element.
+     * @returns The parent of this element or a \e null object when this is
+     * the root element.
+     * @since 1.1
+     **/
+    SSXMLCompactElement parentElement() const;
+    /*}}}*/
+    // bool hasAttributes() const;/*{{{*/
+    /**
+     * Checks whether this element has attributes.
+     * @returns \b true when at least one attribute was defined. Otherwise \b
+     * false.
+     * @since 1.1
+     **/
+    bool hasAttributes() const;
+    /*}}}*/
+    // bool hasChildren() const;/*{{{*/
+    /**
+     * Checks if this element has some children elements.
+     * @returns \b true when at least one child exists. Otherwise \b false.
+     * @since 1.1
+     **/
+    bool hasChildren() const;
+    /*}}}*/
+    // bool has(const QString &attrName) const;/*{{{*/
+    /**
+     * Check when an attribute exists.
+     * @param attrName \c QString with the attribute name.
+     * @return \b true when the attribute exists. \b false otherwise.
+     * @since 1.1
+     **/
+    bool has(const QString &attrName) const;
+    /*}}}*/
+    // size_t numberOfAttributes() const;/*{{{*/
+    /**
+     * Returns the number of attributes this element has.
+     * @since 1.1
+     **/
+    size_t numberOfAttributes() const;
+    /*}}}*/
+    // size_t numberOfChildren() const;/*{{{*/
+    /**
+     * Returns the number of children elements this element has.
+     * @since 1.1
+     **/
+    size_t numberOfChildren() const;
+    /*}}}*/
+    // QString text() const;/*{{{*/
+    /**
+     * Retrieves the text content of this element.
+     * @return A \c QString object with the text of the element if it has one.
+     * Otherwise an empty string.
+     * @since 1.1
+     **/
+    QString text() const;
+    /*}}}*/
+    // QByteArray textUtf8() const;/*{{{*/
+    /**
+     * Retrieves the text content of this element in UTF-8.
+     * @return The text bytes. When the document stores UTF-8, or keeps the
+     * source and the text has nothing to decode, the array points directly
+     * to the document pool and no memory is allocated.
+     * Otherwise the text is converted.
+     * @since 1.1
+     **/
+    QByteArray textUtf8() const;
+    /*}}}*/
+
+public:         // Attributes Operations
+    // QString attribute(const QString &attrName) const;/*{{{*/
+    /**
+     * Gets the value of an attribute of this element.
+     * @param attrName Name of the attribute.
+     * @return The attribute's value as a \c QString object. If an attribute
+     * with the passed name doesn't exists, the result is an empty string.
+     * @since 1.1
+     **/
+    QString attribute(const QString &attrName) const;
+    /*}}}*/
+    // QStringRef attributeRef(const QString &attrName) const;/*{{{*/
+    /**
+     * Gets a reference to the value of an attribute of this element.
+     * @param attrName Name of the attribute.
+     * @return A \c QStringRef pointing directly to the document string pool.
+     * No memory is allocated. If an attribute with the passed name doesn't
+     * exists, the result is a \e null reference.
+     * @remarks When the document stores \c SSXML_STORE_UTF8 or \c
+     * SSXML_STORE_LAZY there is no \c QString to refer to and the result is
+     * always a \e null reference.
+     * Use #attributeUtf8() instead.
+     * @since 1.1
+     **/
+    QStringRef attributeRef(const QString &attrName) const;
+    /*}}}*/
+    // QByteArray attributeUtf8(const QString &attrName) const;/*{{{*/
+    /**
+     * Gets the value of an attribute of this element in UTF-8.
+     * @param attrName Name of the attribute.
+     * @return The value bytes. When the document stores \c SSXML_STORE_UTF8,
+     * or \c SSXML_STORE_LAZY and the value has nothing to decode, the array
+     * points directly to the document pool and no memory is allocated.
+     * Otherwise the value is converted. If an attribute with the passed name
+     * doesn't exists, the result is a \e null array.
+     * @since 1.1
+     **/
+    QByteArray attributeUtf8(const QString &attrName) const;
+    /*}}}*/
+    // int  intValueOf(const QString &attrName, int defaultValue = 0) const;/*{{{*/
+    /**
+     * Converts an attribute's value to \b int.
+     * @param attrName Name of the attribute.
+     * @param defaultValue Optional. A default value to be returned when the
+     * attribute named \a attrName doesn't exists or cannot be converted to an
+     * integer.
+     * @returns An integer value result of the convertion of the attribute's
+     * value named at \a attrName.
+     * @remarks Works exactly like SSXMLElement::intValueOf().
+     * @since 1.1
+     **/
+    int intValueOf(const QString &attrName, int defaultValue = 0) const;
+    /*}}}*/
+    // bool boolValueOf(const QString &attrName, bool defaultValue = false) const;/*{{{*/
+    /**
+     * Converts an attribute's value into \b boolean.
+     * @param attrName Name of the attribute.
+     * @param defaultValue Optional. A default value to be returned when the
+     * attribute named \a attrName doesn't exists or cannot be converted to a
+     * boolean value.
+     * @returns \b true or \b false depend upon the conversion result.
+     * @remarks Works exactly like SSXMLElement::boolValueOf().
+     * @since 1.1
+     **/
+    bool boolValueOf(const QString &attrName, bool defaultValue = false) const;
+    /*}}}*/
+    // QString attributeName(uint index) const;/*{{{*/
+    /**
+     * Gets the name of an attribute by its position.
+     * @param index Zero based index of the attribute. Must be less than
+     * #numberOfAttributes().
+     * @return The attribute's name or an empty string when \a index is out of
+     * range.
+     * @since 1.1
+     **/
+    QString attributeName(uint index) const;
+    /*}}}*/
+    // QString attributeValue(uint index) const;/*{{{*/
+    /**
+     * Gets the value of an attribute by its position.
+     * @param index Zero based index of the attribute. Must be less than
+     * #numberOfAttributes().
+     * @return The attribute's value or an empty string when \a index is out
+     * of range.
+     * @since 1.1
+     **/
+    QString attributeValue(uint index) const;
+    /*}}}*/
+
+public:         // Child Element Operations
+    // int indexOf(const SSXMLCompactElement &element) const;/*{{{*/
+    /**
+     * Gets the index of a child element of this element.
+     * @param element The element whoose index should be returned.
+     * @returns A value equals to or greater than 0 is the index of the
+     * element. A values less than zero means that the passed element is not
+     * a child of this element.
+     * @remarks This operation doesn't do any search. It runs in constant
+     * time.
+     * @since 1.1
+     **/
+    int indexOf(const SSXMLCompactElement &element) const;
+    /*}}}*/
+    // SSXMLCompactElement elementAt(uint index) const;/*{{{*/
+    /**
+     * Returns a child element at the specified index.
+     * @param index Zero based index of the element to return.
+     * @returns The requested element or a \e null object when the specified
+     * index is invalid.
+     * @remarks Children of an element are kept side by side in the document
+     * so this operation runs in constant time.
+     * @since 1.1
+     **/
+    SSXMLCompactElement elementAt(uint index) const;
+    /*}}}*/
+    // SSXMLCompactElement firstElement() const;/*{{{*/
+    /**
+     * Gets the first child element of this element.
+     * @returns The first child element or a \e null object when this element
+     * doesn't have children.
+     * @since 1.1
+     **/
+    SSXMLCompactElement firstElement() const;
+    /*}}}*/
+    // SSXMLCompactElement lastElement() const;/*{{{*/
+    /**
+     * Gets the last child element of this element.
+     * @returns The last child element or a \e null object when this element
+     * doesn't have children.
+     * @since 1.1
+     **/
+    SSXMLCompactElement lastElement() const;
+    /*}}}*/
+    // SSXMLCompactElement nextElement() const;/*{{{*/
+    /**
+     * Gets the next sibling of this element.
+     * @returns The element following this one in its parent's list of
+     * children or a \e null object when this is the last child.
+     * @since 1.1
+     **/
+    SSXMLCompactElement nextElement() const;
+    /*}}}*/
+
+public:         // Overloaded Operators
+    // bool operator ==(const SSXMLCompactElement &other) const;/*{{{*/
+    /**
+     * Checks whether this object references the same element as other.
+     * @param other Other object to compare.
+     * @returns \b true when both objects reference the same element of the
+     * same document.
+     * @since 1.1
+     **/
+    bool operator ==(const SSXMLCompactElement &other) const;
+    /*}}}*/
+    // bool operator !=(const SSXMLCompactElement &other) const;/*{{{*/
+    /**
+     * Checks whether this object references a different element.
+     * @param other Other object to compare.
+     * @returns \b true when the objects reference different elements.
+     * @since 1.1
+     **/
+    bool operator !=(const SSXMLCompactElement &other) const;
+    /*}}}*/
+    // QString operator[](const QString &attrName) const;/*{{{*/
+    /**
+     * Gets the value of an attribute of this element.
+     * @param attrName Name of the attribute.
+     * @return The attribute's value as a \c QString object. If an attribute
+     * with the passed name doesn't exists, the result is an empty string.
+     * @since 1.1
+     **/
+    QString operator[](const QString &attrName) const;
+    /*}}}*/
+
+protected:
+    quint32 findAttribute(const QString &attrName) const;
+
+protected:      // Data Members
+    const SSXMLCompactDocument *m_doc;  /**< Document of this element.      */
+    quint32 m_index;                    /**< Index of this element.         */
+};
+
+/**
+ * @ingroup ssqt_xml
+ * A read only XML document with a compact memory representation.
+ * An \c SSXMLDocument keeps each element in its own heap object with a list
+ * of children pointers and a hash table of attributes. That is flexible but
+ * expensive for large documents that are only read, like configuration
+ * files. This class keeps the same information in a structure of arrays:
+ * - Each element is identified by its index. Elements names are interned in
+ *   a table so each element keeps only a 32 bits name identifier.
+ * - The parent, first child and next sibling links are 32 bits indexes.
+ *   Children of the same element are kept side by side so positional access
+ *   runs in constant time.
+ * - Attributes of an element are a range in an array of name identifiers and
+ *   value ranges.
+ * - All attributes values and texts are ranges in a single string pool.
+ *   Repeated values are stored only once. The pool can keep UTF-8 bytes
+ *   instead of UTF-16 characters (see \c SSXML_STORE_UTF8). Values are then
+ *   decoded when read, or read as bytes with no copy.
+ * .
+ * A compact document is built from an \c SSXMLElement tree using the
+ * #assign() operation or SSXMLDocument::compact(). After that it cannot be
+ * changed. Elements are accessed through \c SSXMLCompactElement objects.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLCompactDocument
+{
+public:
+    SSXMLCompactDocument();
+    explicit SSXMLCompactDocument(const SSXMLElement *root, uint storage = SSXML_STORE_UTF16);
+
+public:         // Attributes
+    // bool isEmpty() const;/*{{{*/
+    /**
+     * Checks whether this document has no elements.
+     * @returns \b true when the document is empty.
+     * @since 1.1
+     **/
+    bool isEmpty() const;
+    /*}}}*/
+    // size_t numberOfElements() const;/*{{{*/
+    /**
+     * Number of elements in this document.
+     * @returns The total number of elements, including the root element.
+     * @since 1.1
+     **/
+    size_t numberOfElements() const;
+    /*}}}*/
+    // size_t numberOfNames() const;/*{{{*/
+    /**
+     * Number of distinct names in this document.
+     * @returns The number of distinct element and attribute names.
+     * @since 1.1
+     **/
+    size_t numberOfNames() const;
+    /*}}}*/
+    // SSXMLCompactElement documentElement() const;/*{{{*/
+    /**
+     * Gets the root element of the document.
+     * @returns The root element or a \e null object when the document is
+     * empty.
+     * @since 1.1
+     **/
+    SSXMLCompactElement documentElement() const;
+    /*}}}*/
+    // SSXMLCompactElement elementAt(quint32 index) const;/*{{{*/
+    /**
+     * Gets an element by its index in the document.
+     * @param index Zero based index of the element. The root element is the
+     * element at index 0. Children of an element always have indexes greater
+     * than the index of its parent.
+     * @returns The element or a \e null object when \a index is invalid.
+     * @since 1.1
+     **/
+    SSXMLCompactElement elementAt(quint32 index) const;
+    /*}}}*/
+    // uint storage() const;/*{{{*/
+    /**
+     * How values and texts are stored.
+     * @returns \c SSXML_STORE_UTF16, \c SSXML_STORE_UTF8 or \c
+     * SSXML_STORE_LAZY, when the document was built by #load().
+     * @since 1.1
+     **/
+    uint storage() const;
+    /*}}}*/
+    // size_t memoryUsage() const;/*{{{*/
+    /**
+     * Estimates the memory used by this document.
+     * @returns The heap memory, in bytes, used by the arrays, the names
+     * table and the strings pool. Compare with SSXMLElement::memoryUsage()
+     * of the tree the document was built from.
+     * @since 1.1
+     **/
+    size_t memoryUsage() const;
+    /*}}}*/
+    // void statistics(SSXMLStatistics *stats) const;/*{{{*/
+    /**
+     * Measures the memory used by this document.
+     * @param stats Receives the counters. Previous values are discarded.
+     * Names are the names table. Values and texts are the bytes they take in
+     * the pool, shared values counted once. Overhead is the arrays. In \c
+     * SSXML_STORE_LAZY documents the markup of the source is overhead too.
+     * @since 1.1
+     **/
+    void statistics(SSXMLStatistics *stats) const;
+    /*}}}*/
+
+public:         // Operations
+    // error_t assign(const SSXMLElement *root, uint storage = SSXML_STORE_UTF16);/*{{{*/
+    /**
+     * Builds this document from an element tree.
+     * @param root The element to be used as root of this document. It and
+     * all its descendants are copied.
+     * @param storage How values and texts are stored. \c SSXML_STORE_UTF8
+     * uses one byte for each ASCII character instead of two, so documents
+     * with mostly ASCII content use about half the memory in the pool. The
+     * values are decoded each time they are read as \c QString.
+     * @return \b 0 (\c SSNO_ERROR) on success. \c SSE_INVAL when \a root is
+     * \b NULL. \c SSE_OVERFLOW when the tree is too large to be represented
+     * with 32 bits indexes.
+     * @remarks Any previous content of this document is released.
+     * @since 1.1
+     **/
+    error_t assign(const SSXMLElement *root, uint storage = SSXML_STORE_UTF16);
+    /*}}}*/
+    // error_t load(const QByteArray &data);/*{{{*/
+    /**
+     * Builds this document directly from XML data, decoding values lazily.
+     * @param data The XML document. Compressed data is decompressed first.
+     * @return \b SSNO_ERROR on success. \c SSE_FTYPE when the data is not
+     * well formed. \c SSE_IO when it ends before the root element is
+     * closed. \c SSE_OVERFLOW when it is too large.
+     * @remarks The document keeps \a data, shared, as its pool and records
+     * only the ranges of names, values and texts. No \c QString is built
+     * for values and texts until they are read. Values with entity
+     * references, character references, CDATA sections, comments or line
+     * breaks are decoded on the first read and the result is cached. Other
+     * values are only converted from UTF-8 when read. When few values are
+     * read this is much faster than building an \c SSXMLDocument first, and
+     * uses less memory.
+     * @remarks Only UTF-8 and ASCII data are kept this way. Documents in
+     * other encodings, or with an internal DTD subset, are loaded with \c
+     * SSXMLDocument and stored as \c SSXML_STORE_UTF8, and so are documents
+     * with unknown entity references, that SSXMLDocument rejects. Other
+     * checks are lighter than in \c QXmlStreamReader: tags must be balanced
+     * and well formed. Texts split by comments, processing instructions or
+     * CDATA sections are decoded by \c QXmlStreamReader, so they keep only
+     * the last part, like SSXMLDocument.
+     * @remarks The cache is filled by \c const functions. Reading a lazy
+     * document from several threads must be synchronized, so it cannot be
+     * published with SSXMLPublisher.
+     * @since 1.1
+     **/
+    error_t load(const QByteArray &data);
+    /*}}}*/
+    // error_t load(const QString &fileName);/*{{{*/
+    /**
+     * Builds this document from a file, decoding values lazily.
+     * @param fileName Name of the file. Compressed files are accepted.
+     * @return \c SSE_IO when the file can't be read. Otherwise the same of
+     * #load(const QByteArray&).
+     * @since 1.1
+     **/
+    error_t load(const QString &fileName);
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Releases all elements of this document.
+     * @since 1.1
+     **/
+    void clear();
+    /*}}}*/
+    // quint32 nameID(const QString &name) const;/*{{{*/
+    /**
+     * Gets the identifier of a name.
+     * @param name Element or attribute name.
+     * @returns The identifier of the name or \c SSXML_NPOS when the name is
+     * not used in this document.
+     * @remarks Names are compared by identifier only. Code looking up the
+     * same name many times can keep its identifier.
+     * @since 1.1
+     **/
+    quint32 nameID(const QString &name) const;
+    /*}}}*/
+    // QString nameOf(quint32 nameID) const;/*{{{*/
+    /**
+     * Gets the name with the specified identifier.
+     * @param nameID The name identifier.
+     * @returns The name or an empty string if \a nameID is not valid.
+     * @since 1.1
+     **/
+    QString nameOf(quint32 nameID) const;
+    /*}}}*/
+
+protected:
+    QStringRef stringAt(quint32 pos, quint32 length) const;
+    QString    valueAt(quint32 pos, quint32 length) const;
+    QByteArray bytesAt(quint32 pos, quint32 length) const;
+    QString    decode(quint32 pos, quint32 length) const;
+
+protected:      // Data Members
+    QVector<quint32> m_name;            /**< Name id of each element.       */
+    QVector<quint32> m_parent;          /**< Parent of each element.        */
+    QVector<quint32> m_child;           /**< First child of each element.   */
+    QVector<quint32> m_next;            /**< Next sibling of each element.  */
+    QVector<quint32> m_count;           /**< Children count of each element.*/
+    QVector<quint32> m_attrs;           /**< First attribute of each element.*/
+    QVector<quint32> m_textPos;         /**< Text position in the pool.     */
+    QVector<quint32> m_textLen;         /**< Text length in the pool.       */
+    QVector<quint32> m_attrName;        /**< Name id of each attribute.     */
+    QVector<quint32> m_valuePos;        /**< Value position in the pool.    */
+    QVector<quint32> m_valueLen;        /**< Value length in the pool.      */
+    QVector<quint32> m_namePos;         /**< Name position in the pool.     */
+    QVector<quint32> m_nameLen;         /**< Name length in the pool.       */
+    QHash<QString, quint32> m_names;    /**< Name to name id map.           */
+    QString m_pool;                     /**< Strings pool.                  */
+    QByteArray m_bytes;                 /**< Values pool in UTF-8 storage.  */
+    size_t  m_textBytes;                /**< Bytes of texts in the pool.    */
+    uint    m_storage;                  /**< Storage of values and texts.   */
+    mutable QHash<quint32, QString> m_decoded; /**< Lazy values decoded.    */
+
+    friend class SSXMLCompactElement;
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactElement: Constructors *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLCompactElement::SSXMLCompactElement();/*{{{*/
+/**
+ * Default constructor.
+ * Builds a \e null element.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLCompactElement::SSXMLCompactElement() : m_doc(NULL), m_index(SSXML_NPOS) { }
+/*}}}*/
+// inline SSXMLCompactElement::SSXMLCompactElement(const SSXMLCompactDocument *document, quint32 index);/*{{{*/
+/**
+ * Builds a reference to an element of a document.
+ * @param document The document owning the element.
+ * @param index Index of the element in the document. When out of range the
+ * object is built as a \e null element.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLCompactElement::SSXMLCompactElement(const SSXMLCompactDocument *document, quint32 index) :
+    m_doc(document), m_index(index) {
+    if (!m_doc || (m_index >= (quint32)m_doc->m_name.size())) {
+        m_doc = NULL; m_index = SSXML_NPOS;
+    }
+}
+/*}}}*/
+///@} SSXMLCompactElement: Constructors /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactElement: Attributes *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline bool SSXMLCompactElement::isNull() const;/*{{{*/
+inline bool SSXMLCompactElement::isNull() const {
+    return (m_doc == NULL);
+}
+/*}}}*/
+// inline quint32 SSXMLCompactElement::index() const;/*{{{*/
+inline quint32 SSXMLCompactElement::index() const {
+    return m_index;
+}
+/*}}}*/
+// inline SSXMLCompactElement SSXMLCompactElement::parentElement() const;/*{{{*/
+inline SSXMLCompactElement SSXMLCompactElement::parentElement() const {
+    if (!m_doc) return SSXMLCompactElement();
+    return SSXMLCompactElement(m_doc, m_doc->m_parent.at(m_index));
+}
+/*}}}*/
+// inline bool SSXMLCompactElement::hasAttributes() const;/*{{{*/
+inline bool SSXMLCompactElement::hasAttributes() const {
+    return (numberOfAttributes() > 0);
+}
+/*}}}*/
+// inline bool SSXMLCompactElement::hasChildren() const;/*{{{*/
+inline bool SSXMLCompactElement::hasChildren() const {
+    return (numberOfChildren() > 0);
+}
+/*}}}*/
+// inline bool SSXMLCompactElement::has(const QString &attrName) const;/*{{{*/
+inline bool SSXMLCompactElement::has(const QString &attrName) const {
+    return (findAttribute(attrName) != SSXML_NPOS);
+}
+/*}}}*/
+// inline size_t SSXMLCompactElement::numberOfAttributes() const;/*{{{*/
+inline size_t SSXMLCompactElement::numberOfAttributes() const {
+    if (!m_doc) return 0;
+    return (m_doc->m_attrs.at(m_index + 1) - m_doc->m_attrs.at(m_index));
+}
+/*}}}*/
+// inline size_t SSXMLCompactElement::numberOfChildren() const;/*{{{*/
+inline size_t SSXMLCompactElement::numberOfChildren() const {
+    if (!m_doc) return 0;
+    return m_doc->m_count.at(m_index);
+}
+/*}}}*/
+///@} SSXMLCompactElement: Attributes /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactElement: Child Element Operations *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLCompactElement SSXMLCompactElement::firstElement() const;/*{{{*/
+inline SSXMLCompactElement SSXMLCompactElement::firstElement() const {
+    return elementAt(0);
+}
+/*}}}*/
+// inline SSXMLCompactElement SSXMLCompactElement::lastElement() const;/*{{{*/
+inline SSXMLCompactElement SSXMLCompactElement::lastElement() const {
+    if (!hasChildren()) return SSXMLCompactElement();
+    return elementAt((uint)numberOfChildren() - 1);
+}
+/*}}}*/
+// inline SSXMLCompactElement SSXMLCompactElement::nextElement() const;/*{{{*/
+inline SSXMLCompactElement SSXMLCompactElement::nextElement() const {
+    if (!m_doc) return SSXMLCompactElement();
+    return SSXMLCompactElement(m_doc, m_doc->m_next.at(m_index));
+}
+/*}}}*/
+///@} SSXMLCompactElement: Child Element Operations /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactElement: Overloaded Operators *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline bool SSXMLCompactElement::operator ==(const SSXMLCompactElement &other) const;/*{{{*/
+inline bool SSXMLCompactElement::operator ==(const SSXMLCompactElement &other) const {
+    return ((m_doc == other.m_doc) && (m_index == other.m_index));
+}
+/*}}}*/
+// inline bool SSXMLCompactElement::operator !=(const SSXMLCompactElement &other) const;/*{{{*/
+inline bool SSXMLCompactElement::operator !=(const SSXMLCompactElement &other) const {
+    return !(*this == other);
+}
+/*}}}*/
+// inline QString SSXMLCompactElement::operator[](const QString &attrName) const;/*{{{*/
+inline QString SSXMLCompactElement::operator[](const QString &attrName) const {
+    return attribute(attrName);
+}
+/*}}}*/
+///@} SSXMLCompactElement: Overloaded Operators /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactDocument: Constructors *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLCompactDocument::SSXMLCompactDocument();/*{{{*/
+/**
+ * Default constructor.
+ * Builds an empty document.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLCompactDocument::SSXMLCompactDocument() : m_textBytes(0), m_storage(SSXML_STORE_UTF16) { }
+/*}}}*/
+// inline SSXMLCompactDocument::SSXMLCompactDocument(const SSXMLElement *root, uint storage = SSXML_STORE_UTF16);/*{{{*/
+/**
+ * Builds a compact document from an element tree.
+ * @param root The root element to copy.
+ * @param storage How values and texts are stored.
+ * @remarks This constructor calls #assign().
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLCompactDocument::SSXMLCompactDocument(const SSXMLElement *root, uint storage) :
+    m_textBytes(0), m_storage(SSXML_STORE_UTF16) {
+    assign(root, storage);
+}
+/*}}}*/
+///@} SSXMLCompactDocument: Constructors /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactDocument: Attributes *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline bool SSXMLCompactDocument::isEmpty() const;/*{{{*/
+inline bool SSXMLCompactDocument::isEmpty() const {
+    return m_name.isEmpty();
+}
+/*}}}*/
+// inline size_t SSXMLCompactDocument::numberOfElements() const;/*{{{*/
+inline size_t SSXMLCompactDocument::numberOfElements() const {
+    return m_name.size();
+}
+/*}}}*/
+// inline size_t SSXMLCompactDocument::numberOfNames() const;/*{{{*/
+inline size_t SSXMLCompactDocument::numberOfNames() const {
+    return m_namePos.size();
+}
+/*}}}*/
+// inline SSXMLCompactElement SSXMLCompactDocument::documentElement() const;/*{{{*/
+inline SSXMLCompactElement SSXMLCompactDocument::documentElement() const {
+    return SSXMLCompactElement(this, 0);
+}
+/*}}}*/
+// inline SSXMLCompactElement SSXMLCompactDocument::elementAt(quint32 index) const;/*{{{*/
+inline SSXMLCompactElement SSXMLCompactDocument::elementAt(quint32 index) const {
+    return SSXMLCompactElement(this, index);
+}
+/*}}}*/
+// inline uint SSXMLCompactDocument::storage() const;/*{{{*/
+inline uint SSXMLCompactDocument::storage() const {
+    return m_storage;
+}
+/*}}}*/
+///@} SSXMLCompactDocument: Attributes /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLCompactDocument: Operations *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline quint32 SSXMLCompactDocument::nameID(const QString &name) const;/*{{{*/
+inline quint32 SSXMLCompactDocument::nameID(const QString &name) const {
+    return m_names.value(name, SSXML_NPOS);
+}
+/*}}}*/
+// inline QStringRef SSXMLCompactDocument::stringAt(quint32 pos, quint32 length) const;/*{{{*/
+inline QStringRef SSXMLCompactDocument::stringAt(quint32 pos, quint32 length) const {
+    return QStringRef(&m_pool, (int)pos, (int)length);
+}
+/*}}}*/
+// inline QString SSXMLCompactDocument::valueAt(quint32 pos, quint32 length) const;/*{{{*/
+inline QString SSXMLCompactDocument::valueAt(quint32 pos, quint32 length) const {
+    if (m_storage == SSXML_STORE_UTF16)
+        return stringAt(pos, length).toString();
+    if (length & SSXML_RAW_ESCAPED)
+        return decode(pos, length);
+    return QString::fromUtf8(m_bytes.constData() + pos, (int)length);
+}
+/*}}}*/
+// inline QByteArray SSXMLCompactDocument::bytesAt(quint32 pos, quint32 length) const;/*{{{*/
+inline QByteArray SSXMLCompactDocument::bytesAt(quint32 pos, quint32 length) const {
+    if (m_storage == SSXML_STORE_UTF16)
+        return stringAt(pos, length).toUtf8();
+    if (length & SSXML_RAW_ESCAPED)
+        return decode(pos, length).toUtf8();
+    return QByteArray::fromRawData(m_bytes.constData() + pos, (int)length);
+}
+/*}}}*/
+///@} SSXMLCompactDocument: Operations /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLC_HPP_DEFINED__ */
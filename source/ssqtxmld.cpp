@@ -19,6 +19,9 @@
 #include "ssqtdbg.hpp"
 #include "ssqtxmle.hpp"
 #include "ssqtxmld.hpp"
+#include "ssqtxmlc.hpp"
+#include "ssqtxmlj.hpp"
+#include "ssqtgzip.hpp"
 
 /* ===========================================================================
  * SSXMLDocument class
@@ -27,19 +30,127 @@
 /* ---------------------------------------------------------------------------
  * Internal Functions
  * ------------------------------------------------------------------------ */
-// static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root);/*{{{*/
+// static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root, SSXMLStatistics *stats, const QList<QStringList> *paths);/*{{{*/
 /**
  * Reads XML data into a root element.
  * @param reader Pointer to a \c QXmlStreamReader object with the XML document
  * loaded.
  * @param root Pointer to the \c SSXMLElement that will receive the root XML
  * element in the document. All XML hierarchi will be applied to this object.
+ * @param stats Pointer to the \c SSXMLStatistics that will receive the
+ * statistics of the loaded document. Its counters are reset before reading.
+ * @param paths Steps of the path patterns selecting the subtrees to load.
+ * When \b NULL the whole document is loaded.
  * @returns An error code. \c SSNO_ERROR means success.
  * @since 1.1
  *//* --------------------------------------------------------------------- */
-static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root);
+static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root, SSXMLStatistics *stats, const QList<QStringList> *paths);
+/*}}}*/
+// static void __xml_findAll(SSXMLElement *element, const QString &attrName, const QString &value, QList<SSXMLElement*> *list, size_t limit);/*{{{*/
+/**
+ * Finds elements by an attribute value walking the tree.
+ * @param element The root of the subtree to search.
+ * @param attrName The attribute name.
+ * @param value The attribute value.
+ * @param list Receives the elements found, in document order.
+ * @param limit Maximum number of elements in \a list. Zero means no limit.
+ * @since 1.1
+ **/
+static void __xml_findAll(SSXMLElement *element, const QString &attrName, const QString &value, QList<SSXMLElement*> *list, size_t limit);
+/*}}}*/
+// static bool __xml_precedes(const SSXMLElement *first, const SSXMLElement *second);/*{{{*/
+/**
+ * Compares the position of two elements of the same tree.
+ * @param first An element.
+ * @param second Another element.
+ * @returns \b true when \a first comes before \a second in document order.
+ * @remarks Costs the depth of the elements plus the number of children of
+ * their nearest common ancestor.
+ * @since 1.1
+ **/
+static bool __xml_precedes(const SSXMLElement *first, const SSXMLElement *second);
+/*}}}*/
+// static void __xml_insertOrdered(QList<SSXMLElement*> *list, SSXMLElement *element);/*{{{*/
+/**
+ * Inserts an element in a list kept in document order.
+ * @param list The list.
+ * @param element The element to insert.
+ * @since 1.1
+ **/
+static void __xml_insertOrdered(QList<SSXMLElement*> *list, SSXMLElement *element);
+/*}}}*/
+// static error_t __xml_compilePaths(const QStringList &patterns, QList<QStringList> *paths);/*{{{*/
+/**
+ * Splits path patterns in its steps.
+ * @param patterns List of path patterns as accepted by SSXMLDocument::open().
+ * @param paths Receives the steps of each pattern.
+ * @returns \c SSNO_ERROR on success. \c SSE_INVAL when a pattern is not an
+ * absolute path or when there are more than \c SSXML_MAX_PATHS patterns.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static error_t __xml_compilePaths(const QStringList &patterns, QList<QStringList> *paths);
+/*}}}*/
+// static QString __xml_mergeKey(const SSXMLElement *element, const QStringList &keys);/*{{{*/
+/**
+ * Builds the key that identifies an element among its siblings.
+ * @param element The element.
+ * @param keys Names of the key attributes, in order of preference.
+ * @returns The element name, the first key attribute found and its value.
+ * An empty string when the element has none of the key attributes.
+ * @since 1.1
+ **/
+static QString __xml_mergeKey(const SSXMLElement *element, const QStringList &keys);
+/*}}}*/
+// static void __xml_merge(SSXMLElement *base, const SSXMLElement *overlay, const QStringList &keys, uint mode);/*{{{*/
+/**
+ * Merges an overlay element into a base element.
+ * @param base The element changed.
+ * @param overlay The element applied.
+ * @param keys Names of the key attributes.
+ * @param mode \c SSXML_MERGE_REPLACE or \c SSXML_MERGE_APPEND.
+ * @since 1.1
+ **/
+static void __xml_merge(SSXMLElement *base, const SSXMLElement *overlay, const QStringList &keys, uint mode);
 /*}}}*/
 
+/**
+ * @internal
+ * Detaches the journal of a document while the document is loaded or
+ * assigned. The journal is cleared when it is attached again, since the
+ * changes it has don't apply to the new content.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLJournalSuspend
+{
+public:
+    SSXMLJournalSuspend(SSXMLJournal *&journal) : m_slot(journal), m_journal(journal) {
+        m_slot = NULL;
+    }
+
+    ~SSXMLJournalSuspend() {
+        m_slot = m_journal;
+        if (m_journal) m_journal->clear();
+    }
+
+protected:
+    SSXMLJournal *&m_slot;
+    SSXMLJournal *m_journal;
+};
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLDocument::~SSXMLDocument();/*{{{*/
+SSXMLDocument::~SSXMLDocument()
+{
+    journal(NULL);
+
+    if (!m_indexed.isEmpty())
+        watch(false);
+}
+/*}}}*/
+///@} Constructors & Destructor
+
 /* ------------------------------------------------------------------------ */
 /*! \name Read Operations */ //@{
 /* ------------------------------------------------------------------------ */
@@ -47,41 +158,122 @@ static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root)
 error_t SSXMLDocument::open(const QString &fileName, const char *encoding)
 {
     QFile file(fileName);
-    return open(file, encoding);
+    return open(file, QStringList(), encoding);
 }
 /*}}}*/
 // error_t SSXMLDocument::open(QFile &file, const char *encoding = NULL);/*{{{*/
 error_t SSXMLDocument::open(QFile &file, const char *encoding)
+{
+    return open(file, QStringList(), encoding);
+}
+/*}}}*/
+// error_t SSXMLDocument::open(const QByteArray &byteArray, const char *encoding = NULL);/*{{{*/
+error_t SSXMLDocument::open(const QByteArray &byteArray, const char *encoding)
+{
+    return open(byteArray, QStringList(), encoding);
+}
+/*}}}*/
+// error_t SSXMLDocument::open(const QString &fileName, const QStringList &paths, const char *encoding = NULL);/*{{{*/
+error_t SSXMLDocument::open(const QString &fileName, const QStringList &paths, const char *encoding)
+{
+    QFile file(fileName);
+    return open(file, paths, encoding);
+}
+/*}}}*/
+// error_t SSXMLDocument::open(QFile &file, const QStringList &paths, const char *encoding = NULL);/*{{{*/
+error_t SSXMLDocument::open(QFile &file, const QStringList &paths, const char *encoding)
 {
     Q_UNUSED(encoding);
 
+    QList<QStringList> steps;
+    error_t result = __xml_compilePaths(paths, &steps);
+
+    if (result != SSNO_ERROR)
+        return result;
+
     if (!file.open(QIODevice::ReadOnly))
     {
         sstrace("Error: '%s'", SST(file.errorString()));
         return SSE_IO;
     }
 
-    QXmlStreamReader stream(&file);
-    error_t result = SSNO_ERROR;
+    const QList<QStringList> *filter = (steps.isEmpty() ? NULL : &steps);
+    SSXMLJournalSuspend suspend(m_journal);
+    SSXMLStatistics stats;          /* Kept only when the load succeeds. */
+
+    resetIndex();                   /* Rebuilt after the load. */
+
+    if (SSGZipDevice::isCompressed(&file))
+    {
+        SSGZipDevice zip(&file);
 
-    result = __xml_readXmlStream(&stream, this);
+        if (!zip.open(QIODevice::ReadOnly))
+            result = SSE_IO;
+        else
+        {
+            QXmlStreamReader stream(&zip);
+            result = __xml_readXmlStream(&stream, this, &stats, filter);
+        }
+    }
+    else
+    {
+        QXmlStreamReader stream(&file);
+        result = __xml_readXmlStream(&stream, this, &stats, filter);
+    }
     file.close();
     if (result == SSNO_ERROR)
+    {
         fileName = file.fileName();
+        m_stats  = stats;
+    }
     else
         fileName = QString();
 
+    buildIndex();
     return result;
 }
 /*}}}*/
-// error_t SSXMLDocument::open(const QByteArray &byteArray, const char *encoding = NULL);/*{{{*/
-error_t SSXMLDocument::open(const QByteArray &byteArray, const char *encoding)
+// error_t SSXMLDocument::open(const QByteArray &byteArray, const QStringList &paths, const char *encoding = NULL);/*{{{*/
+error_t SSXMLDocument::open(const QByteArray &byteArray, const QStringList &paths, const char *encoding)
 {
     Q_UNUSED(encoding);
 
+    QList<QStringList> steps;
+    error_t result = __xml_compilePaths(paths, &steps);
+
+    if (result != SSNO_ERROR)
+        return result;
+
+    const QList<QStringList> *filter = (steps.isEmpty() ? NULL : &steps);
+    SSXMLJournalSuspend suspend(m_journal);
+    SSXMLStatistics stats;          /* Kept only when the load succeeds. */
+
     fileName = QString();
-    QXmlStreamReader reader(byteArray);
-    return __xml_readXmlStream(&reader, this);
+    resetIndex();                   /* Rebuilt after the load. */
+
+    if (SSGZipDevice::isCompressed(byteArray))
+    {
+        QBuffer buffer(const_cast<QByteArray*>(&byteArray));
+        SSGZipDevice zip(&buffer);
+
+        if (!buffer.open(QIODevice::ReadOnly) || !zip.open(QIODevice::ReadOnly))
+            result = SSE_IO;
+        else
+        {
+            QXmlStreamReader reader(&zip);
+            result = __xml_readXmlStream(&reader, this, &stats, filter);
+        }
+    }
+    else
+    {
+        QXmlStreamReader reader(byteArray);
+        result = __xml_readXmlStream(&reader, this, &stats, filter);
+    }
+    if (result == SSNO_ERROR)
+        m_stats = stats;
+
+    buildIndex();
+    return result;
 }
 /*}}}*/
 ///@} Read Operations
@@ -96,7 +288,7 @@ error_t SSXMLDocument::write(const char *encoding)
         return SSE_INVAL;
 
     QFile file(fileName);
-    return write(&file, encoding);
+    return write(file, encoding);
 }
 /*}}}*/
 // error_t SSXMLDocument::write(const QString &fileName, const char *encoding = NULL);/*{{{*/
@@ -109,16 +301,20 @@ error_t SSXMLDocument::write(const QString &fileName, const char *encoding)
 // error_t SSXMLDocument::write(QFile &file, const char *encoding = NULL);/*{{{*/
 error_t SSXMLDocument::write(QFile &file, const char *encoding)
 {
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
-        return SSE_IO;
-
-    return write(&file, encoding);
+    if (file.fileName().endsWith(SSGZIP_SUFFIX, Qt::CaseInsensitive))
+    {
+        SSGZipDevice zip(&file);
+        return write(&zip, encoding);
+    }
+    return write(static_cast<QIODevice*>(&file), encoding);
 }
 /*}}}*/
 // error_t SSXMLDocument::write(QIODevice *device, const char *encoding = NULL);/*{{{*/
 error_t SSXMLDocument::write(QIODevice *device, const char *encoding)
 {
-    if (!device->open(QIODevice::WriteOnly | QIODevice::Text))
+    bool opened = device->isOpen();
+
+    if (!opened && !device->open(QIODevice::WriteOnly | QIODevice::Text))
         return SSE_IO;
 
     QString xmlHeader;
@@ -140,35 +336,322 @@ error_t SSXMLDocument::write(QIODevice *device, const char *encoding)
     if (!SSXMLElement::write(device))
         result = SSE_IO;
 
-    device->close();
+    /* A compressed file is complete only with its trailer. */
+    SSGZipDevice *zip = qobject_cast<SSGZipDevice*>(device);
+    if (!opened && zip && !zip->finish())
+        result = SSE_IO;
+
+    if (!opened) device->close();
     return result;
 }
 /*}}}*/
 ///@} Write Operations
 
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLDocument::compact(SSXMLCompactDocument *document, uint storage = SSXML_STORE_UTF16) const;/*{{{*/
+error_t SSXMLDocument::compact(SSXMLCompactDocument *document, uint storage) const
+{
+    if (!document) return SSE_INVAL;
+    return document->assign(this, storage);
+}
+/*}}}*/
+// error_t SSXMLDocument::merge(const SSXMLElement *overlay, const QStringList &keys, uint mode = SSXML_MERGE_REPLACE);/*{{{*/
+error_t SSXMLDocument::merge(const SSXMLElement *overlay, const QStringList &keys, uint mode)
+{
+    if (!overlay) return SSE_INVAL;
+
+    if (elementName.isEmpty() && !hasAttributes() && !hasChildren())
+    {
+        SSXMLElement::assign(overlay);
+        return SSNO_ERROR;
+    }
+
+    if (overlay->elementName != elementName)
+        return SSE_INVAL;
+
+    __xml_merge(this, overlay, keys, mode);
+    return SSNO_ERROR;
+}
+/*}}}*/
+// error_t SSXMLDocument::merge(const QString &fileName, const QStringList &keys, uint mode = SSXML_MERGE_REPLACE);/*{{{*/
+error_t SSXMLDocument::merge(const QString &fileName, const QStringList &keys, uint mode)
+{
+    SSXMLDocument overlay;
+    error_t result = overlay.open(fileName);
+
+    if (result != SSNO_ERROR)
+        return result;
+
+    return merge(&overlay, keys, mode);
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Attribute Index */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLDocument::addIndex(const QString &attrName);/*{{{*/
+void SSXMLDocument::addIndex(const QString &attrName)
+{
+    if (attrName.isEmpty() || m_indexed.contains(attrName))
+        return;
+
+    if (m_indexed.isEmpty())
+        watch(true);
+
+    m_indexed.append(attrName);
+    buildIndex();
+}
+/*}}}*/
+// void SSXMLDocument::removeIndex(const QString &attrName);/*{{{*/
+void SSXMLDocument::removeIndex(const QString &attrName)
+{
+    if (!m_indexed.removeOne(attrName))
+        return;
+
+    m_indexes.remove(attrName);
+
+    if (m_indexed.isEmpty())
+    {
+        watch(false);
+        resetIndex();
+    }
+}
+/*}}}*/
+// SSXMLElement* SSXMLDocument::elementWith(const QString &attrName, const QString &value) const;/*{{{*/
+SSXMLElement* SSXMLDocument::elementWith(const QString &attrName, const QString &value) const
+{
+    QList<SSXMLElement*> list;
+
+    if (!m_indexBuilt || !m_indexed.contains(attrName))
+        __xml_findAll(const_cast<SSXMLDocument*>(this), attrName, value, &list, 1);
+    else
+        list = m_indexes.value(attrName).value(value);
+
+    return (list.isEmpty() ? NULL : list.first());
+}
+/*}}}*/
+// QList<SSXMLElement*> SSXMLDocument::elementsWith(const QString &attrName, const QString &value) const;/*{{{*/
+QList<SSXMLElement*> SSXMLDocument::elementsWith(const QString &attrName, const QString &value) const
+{
+    QList<SSXMLElement*> list;
+
+    if (!m_indexBuilt || !m_indexed.contains(attrName))
+        __xml_findAll(const_cast<SSXMLDocument*>(this), attrName, value, &list, 0);
+    else
+        list = m_indexes.value(attrName).value(value);
+
+    return list;
+}
+/*}}}*/
+///@} Attribute Index
+
+/* ------------------------------------------------------------------------ */
+/*! \name Journal */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLDocument::journal(SSXMLJournal *journal);/*{{{*/
+void SSXMLDocument::journal(SSXMLJournal *journal)
+{
+    if (journal == m_journal) return;
+
+    if (m_journal != NULL)
+    {
+        m_journal->m_document = NULL;
+        m_journal->m_last = NULL;
+        m_journal->m_pending.clear();
+        watch(false);
+    }
+
+    if (journal != NULL)
+    {
+        if (journal->m_document != NULL)
+            journal->m_document->journal(NULL);
+
+        journal->m_document = this;
+        journal->m_last = NULL;
+        watch(true);
+    }
+    m_journal = journal;
+}
+/*}}}*/
+///@} Journal
+
+/* ------------------------------------------------------------------------ */
+/*! \name Change Notification */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLDocument::changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);/*{{{*/
+void SSXMLDocument::changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous)
+{
+    if (m_journal != NULL)
+        m_journal->record(change, element, index, name, previous);
+
+    if (!m_indexBuilt) return;
+
+    switch (change)
+    {
+    case SSXML_ATTRIBUTE_CHANGED:
+    case SSXML_ATTRIBUTE_REMOVED:
+        {
+            QHash<QString, QHash<QString, QList<SSXMLElement*> > >::iterator it = m_indexes.find(name);
+            if (it == m_indexes.end()) break;
+
+            if (previous)
+            {
+                QHash<QString, QList<SSXMLElement*> >::iterator old = it.value().find(*previous);
+                if (old != it.value().end())
+                {
+                    old.value().removeOne(element);
+                    if (old.value().isEmpty()) it.value().erase(old);
+                }
+            }
+
+            if (change == SSXML_ATTRIBUTE_CHANGED)
+                __xml_insertOrdered(&it.value()[element->m_attrs.value(name)], element);
+        }
+        break;
+    case SSXML_CHILD_ADDED:
+        indexTree(element, true, true);
+        break;
+    case SSXML_CHILD_REMOVED:
+        indexTree(element, false, false);
+        break;
+    }
+}
+/*}}}*/
+// void SSXMLDocument::released(SSXMLElement *element, bool owned);/*{{{*/
+void SSXMLDocument::released(SSXMLElement *element, bool owned)
+{
+    if (m_journal != NULL)
+        m_journal->release(element, owned);
+}
+/*}}}*/
+///@} Change Notification
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLDocument::buildIndex();/*{{{*/
+/**
+ * Builds the index of all attributes passed to #addIndex().
+ * Does nothing when there are none.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLDocument::buildIndex()
+{
+    resetIndex();
+    if (m_indexed.isEmpty()) return;
+
+    size_t limit = m_indexed.count();
+    for (size_t i = 0; i < limit; ++i)
+        m_indexes.insert(m_indexed.at(i), QHash<QString, QList<SSXMLElement*> >());
+
+    /* The walk is in document order, so elements are just appended. */
+    indexTree(this, true, false);
+    m_indexBuilt = true;
+}
+/*}}}*/
+// void SSXMLDocument::indexTree(SSXMLElement *element, bool add, bool ordered);/*{{{*/
+/**
+ * Adds or removes the indexed attributes of a subtree.
+ * @param element The root of the subtree.
+ * @param add \b true to add the attributes, \b false to remove them.
+ * @param ordered When adding, \b true inserts each element at its position
+ * in document order. \b false appends it, for walks that visit elements
+ * after all the ones already indexed.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLDocument::indexTree(SSXMLElement *element, bool add, bool ordered)
+{
+    QHash<QString, QHash<QString, QList<SSXMLElement*> > >::iterator it;
+    QHash<QString, QString>::const_iterator attr;
+
+    for (it = m_indexes.begin(); it != m_indexes.end(); ++it)
+    {
+        attr = element->m_attrs.constFind(it.key());
+        if (attr == element->m_attrs.cend())
+            continue;
+
+        if (add)
+        {
+            QList<SSXMLElement*> &list = it.value()[attr.value()];
+
+            if (ordered)
+                __xml_insertOrdered(&list, element);
+            else
+                list.append(element);
+        }
+        else
+        {
+            QHash<QString, QList<SSXMLElement*> >::iterator old = it.value().find(attr.value());
+            if (old == it.value().end()) continue;
+
+            old.value().removeOne(element);
+            if (old.value().isEmpty()) it.value().erase(old);
+        }
+    }
+
+    size_t limit = element->m_nodes.count();
+    for (size_t i = 0; i < limit; ++i)
+        indexTree(element->m_nodes.at(i), add, ordered);
+}
+/*}}}*/
+// void SSXMLDocument::resetIndex();/*{{{*/
+/**
+ * Discards the index. Changes are not tracked until #buildIndex() is called.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLDocument::resetIndex()
+{
+    m_indexes.clear();
+    m_indexBuilt = false;
+}
+/*}}}*/
+///@} Implementation
+
 /* ------------------------------------------------------------------------ */
 /*! @name Overloaded Operators */ //@{
 /* ------------------------------------------------------------------------ */
 // SSXMLDocument& SSXMLDocument::operator=(const SSXMLDocument &document);/*{{{*/
 SSXMLDocument& SSXMLDocument::operator=(const SSXMLDocument &document)
 {
+    SSXMLJournalSuspend suspend(m_journal);
+
     fileName = document.fileName;
+    m_stats  = document.m_stats;
+
+    resetIndex();
     assign( &document );
+    buildIndex();
     return *this;
 }
 /*}}}*/
 ///@} Overloaded Operators
 
-// static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root);/*{{{*/
-static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root)
+// static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root, SSXMLStatistics *stats, const QList<QStringList> *paths);/*{{{*/
+static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root, SSXMLStatistics *stats, const QList<QStringList> *paths)
 {
-    if (!reader || !root) return SSE_INVAL;
+    if (!reader || !root || !stats) return SSE_INVAL;
 
     QXmlStreamReader::TokenType type = QXmlStreamReader::EndDocument;
     QXmlStreamAttributes attributes;
     QXmlStreamAttribute  attribute;
     SSXMLElement *current = NULL;
-    size_t limit;
+    size_t limit, depth = 0;
+
+    /* Path filtering. 'alive' has, for each open element outside a selected
+     * subtree, the set of patterns that still match its path. 'inside' is
+     * the depth of the selected subtree being loaded, or zero. */
+    QVector<quint64> alive;
+    size_t inside = 0;
+
+    stats->clear();
+
+    /* Previous content is replaced. */
+    root->removeAllElements();
+    root->removeAllAttributes();
+    root->text(QString());
 
     while (!reader->atEnd())
     {
@@ -177,11 +660,58 @@ static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root)
             break;
 
         if (type == QXmlStreamReader::EndElement)
+        {
+            /* The element is complete. Its containers have their final size. */
+            stats->overheadBytes += sizeof(SSXMLElement);
+            stats->overheadBytes += SSXMLStatistics::listBytes(current->numberOfChildren());
+            stats->overheadBytes += SSXMLStatistics::hashBytes(current->numberOfAttributes(), current->attributes().capacity());
+            stats->textBytes     += SSXMLStatistics::stringBytes(current->text().length());
+
+            if (paths && (!inside || (inside == depth)))
+                alive.pop_back();
+            if (inside == depth)
+                inside = 0;
+
             current = current->parentElement;
+            --depth;
+        }
         else if ((type == QXmlStreamReader::Characters) && (current != NULL))
             current->text( reader->text().toString() );    /* Fails if 'current' has children. */
         else if (type == QXmlStreamReader::StartElement)
         {
+            if (paths && !inside)
+            {
+                quint64 parentMask = (depth ? alive.last() : ~Q_UINT64_C(0));
+                quint64 mask = 0;
+                bool   match = false;
+
+                limit = paths->count();
+                for (size_t p = 0; p < limit; ++p)
+                {
+                    const QStringList &steps = paths->at(p);
+
+                    if (!(parentMask & (Q_UINT64_C(1) << p)) || (depth >= (size_t)steps.count()))
+                        continue;
+
+                    if ((steps.at(depth) == QLatin1String("*")) || (reader->name() == steps.at(depth)))
+                    {
+                        mask |= (Q_UINT64_C(1) << p);
+                        match = match || ((depth + 1) == (size_t)steps.count());
+                    }
+                }
+
+                /* The root element is always kept. Other elements outside the
+                 * selected paths are skipped without being built. */
+                if (!mask && depth)
+                {
+                    reader->skipCurrentElement();
+                    continue;
+                }
+
+                alive.append(mask);
+                if (match) inside = depth + 1;
+            }
+
             if (current)
             {
                 current->append(new SSXMLElement(reader->name().toString()));
@@ -195,11 +725,22 @@ static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root)
 
             attributes = reader->attributes();
             limit      = attributes.count();
+
+            current->reserveAttributes(limit);     /* Set without rehashing. */
             for (size_t i = 0; i < limit; ++i)
             {
                 attribute = attributes[i];
                 current->set(attribute.name().toString(), attribute.value().toString());
+
+                stats->nameBytes  += SSXMLStatistics::stringBytes(attribute.name().length());
+                stats->valueBytes += SSXMLStatistics::stringBytes(attribute.value().length());
             }
+
+            stats->elements++;
+            stats->attributes += limit;
+            stats->nameBytes  += SSXMLStatistics::stringBytes(current->elementName.length());
+            if (++depth > stats->maxDepth)
+                stats->maxDepth = depth;
         }
     };
 
@@ -221,4 +762,203 @@ static error_t __xml_readXmlStream(QXmlStreamReader *reader, SSXMLElement *root)
     return SSNO_ERROR;
 }
 /*}}}*/
+// static error_t __xml_compilePaths(const QStringList &patterns, QList<QStringList> *paths);/*{{{*/
+static error_t __xml_compilePaths(const QStringList &patterns, QList<QStringList> *paths)
+{
+    size_t limit = patterns.count();
+
+    if (limit > SSXML_MAX_PATHS)
+        return SSE_INVAL;
+
+    paths->clear();
+    for (size_t i = 0; i < limit; ++i)
+    {
+        const QString &pattern = patterns.at(i);
+
+        if (!pattern.startsWith('/'))
+            return SSE_INVAL;
+
+        QStringList steps = pattern.split('/', QString::SkipEmptyParts);
+        if (steps.isEmpty())
+            return SSE_INVAL;
+
+        paths->append(steps);
+    }
+    return SSNO_ERROR;
+}
+/*}}}*/
+// static void __xml_findAll(SSXMLElement *element, const QString &attrName, const QString &value, QList<SSXMLElement*> *list, size_t limit);/*{{{*/
+static void __xml_findAll(SSXMLElement *element, const QString &attrName, const QString &value, QList<SSXMLElement*> *list, size_t limit)
+{
+    QHash<QString, QString>::const_iterator it = element->attributes().constFind(attrName);
+
+    if ((it != element->attributes().cend()) && (it.value() == value))
+        list->append(element);
+
+    size_t count = element->numberOfChildren();
+    for (size_t i = 0; (i < count) && ((limit == 0) || ((size_t)list->count() < limit)); ++i)
+        __xml_findAll(element->elementAt(i), attrName, value, list, limit);
+}
+/*}}}*/
+// static bool __xml_precedes(const SSXMLElement *first, const SSXMLElement *second);/*{{{*/
+static bool __xml_precedes(const SSXMLElement *first, const SSXMLElement *second)
+{
+    QVector<const SSXMLElement*> a, b;
+
+    for (const SSXMLElement *node = first; node != NULL; node = node->parentElement)
+        a.append(node);
+
+    for (const SSXMLElement *node = second; node != NULL; node = node->parentElement)
+        b.append(node);
+
+    /* Both chains end at the root. Walk back to where they split. */
+    int i = a.count() - 1, j = b.count() - 1;
+
+    while ((i >= 0) && (j >= 0) && (a.at(i) == b.at(j)))
+    {
+        i--; j--;
+    }
+
+    if (i < 0) return (j >= 0);     /* first is an ancestor of second. */
+    if (j < 0) return false;        /* second is an ancestor of first. */
+
+    const SSXMLElement *parent = a.at(i + 1);
+    return (parent->indexOf(a.at(i)) < parent->indexOf(b.at(j)));
+}
+/*}}}*/
+// static void __xml_insertOrdered(QList<SSXMLElement*> *list, SSXMLElement *element);/*{{{*/
+static void __xml_insertOrdered(QList<SSXMLElement*> *list, SSXMLElement *element)
+{
+    int first = 0, last = list->count();
+
+    /* Lists of unique values are empty here. Only duplicated values pay for
+     * the comparisons. */
+    while (first < last)
+    {
+        int middle = (first + last) / 2;
+
+        if (__xml_precedes(list->at(middle), element))
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    list->insert(first, element);
+}
+/*}}}*/
+// static QString __xml_mergeKey(const SSXMLElement *element, const QStringList &keys);/*{{{*/
+static QString __xml_mergeKey(const SSXMLElement *element, const QStringList &keys)
+{
+    const QHash<QString, QString> &attrs = element->attributes();
+    QHash<QString, QString>::const_iterator it;
+    size_t limit = keys.count();
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        it = attrs.constFind(keys.at(i));
+        if (it == attrs.cend()) continue;
+
+        /* Names can't have a null character, so the parts don't mix. */
+        return (element->elementName + QChar(0) + it.key() + QChar(0) + it.value());
+    }
+    return QString();
+}
+/*}}}*/
+// static void __xml_merge(SSXMLElement *base, const SSXMLElement *overlay, const QStringList &keys, uint mode);/*{{{*/
+static void __xml_merge(SSXMLElement *base, const SSXMLElement *overlay, const QStringList &keys, uint mode)
+{
+    const QHash<QString, QString> &attrs = overlay->attributes();
+    QHash<QString, QString>::const_iterator it;
+
+    for (it = attrs.constBegin(); it != attrs.constEnd(); ++it)
+    {
+        if (!base->has(it.key()) || (base->attribute(it.key()) != it.value()))
+            base->set(it.key(), it.value());
+    }
+
+    size_t count = overlay->numberOfChildren();
+    if (count == 0)
+    {
+        if (!overlay->text().isEmpty())
+        {
+            base->removeAllElements();
+            base->text(overlay->text());
+        }
+        return;
+    }
+
+    /* Keys of both sides are computed once. Unkeyed children are counted
+     * by name to tell single elements from lists. */
+    QVector<QString> overlayKeys(count);
+    QHash<QString, int> overlayNames;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        overlayKeys[i] = __xml_mergeKey(overlay->elementAt(i), keys);
+        if (overlayKeys.at(i).isEmpty())
+            overlayNames[overlay->elementAt(i)->elementName]++;
+    }
+
+    QHash<QString, SSXMLElement*> keyed;
+    QHash<QString, SSXMLElement*> single;
+    QHash<QString, int> baseNames;
+    size_t limit = base->numberOfChildren();
+    QVector<bool> unkeyed(limit);
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        SSXMLElement *child = base->elementAt(i);
+        QString key = __xml_mergeKey(child, keys);
+
+        unkeyed[i] = key.isEmpty();
+        if (unkeyed.at(i))
+        {
+            baseNames[child->elementName]++;
+            single.insert(child->elementName, child);
+        }
+        else if (!keyed.contains(key))
+            keyed.insert(key, child);
+    }
+
+    /* Lists replaced by the overlay are removed in a single pass. */
+    QSet<QString> lists;
+    QHash<QString, int>::const_iterator name;
+
+    for (name = overlayNames.constBegin(); name != overlayNames.constEnd(); ++name)
+    {
+        if ((name.value() == 1) && (baseNames.value(name.key()) == 1))
+            continue;
+        lists.insert(name.key());
+    }
+
+    if ((mode == SSXML_MERGE_REPLACE) && !lists.isEmpty())
+    {
+        QList<SSXMLElement*> replaced;
+
+        for (size_t i = 0; i < limit; ++i)
+        {
+            if (unkeyed.at(i) && lists.contains(base->elementAt(i)->elementName))
+                replaced.append(base->elementAt(i));
+        }
+        base->removeElements(replaced);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const SSXMLElement *child = overlay->elementAt(i);
+        SSXMLElement *match;
+
+        if (!overlayKeys.at(i).isEmpty())
+            match = keyed.value(overlayKeys.at(i), NULL);
+        else if (!lists.contains(child->elementName))
+            match = single.value(child->elementName, NULL);
+        else
+            match = NULL;
+
+        if (match)
+            __xml_merge(match, child, keys, mode);
+        else
+            base->append(*child);
+    }
+}
+/*}}}*/
 
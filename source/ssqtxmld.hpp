@@ -18,6 +18,31 @@
 
 #include <QByteArray>
 #include <QFile>
+#include <QStringList>
+#include <QMultiHash>
+#include "ssqtxmlc.hpp"
+
+/**
+ * @internal
+ * Forward declarations.
+ * @{ *//* ---------------------------------------------------------------- */
+class SSXMLJournal;
+///@} internal
+
+/**
+ * \ingroup ssqt_xml
+ * Maximum number of path patterns accepted by SSXMLDocument::open().
+ * @since 1.1
+ **/
+#define SSXML_MAX_PATHS     64
+
+/**
+ * \ingroup ssqt_xml
+ * How SSXMLDocument::merge() handles repeated children without a key.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_MERGE_REPLACE 0       /**< Overlay list replaces the base.    */
+#define SSXML_MERGE_APPEND  1       /**< Overlay list is appended.          */
+///@}
 
 /**
  * @ingroup ssqt_xml
@@ -72,6 +97,23 @@ public:     // Constructors & Destructor
      **/
     SSXMLDocument(const SSXMLDocument &document);
     /*}}}*/
+    virtual ~SSXMLDocument();
+
+public:     // Attributes
+    // const SSXMLStatistics& loadStatistics() const;/*{{{*/
+    /**
+     * Statistics gathered while the document was loaded.
+     * @return A reference to the statistics counted by the last successful
+     * call to one of the #open() functions. All counters are zero when the
+     * document was not loaded from a file or memory. A failed call leaves
+     * the previous counters in place.
+     * @remarks The counters are kept while parsing, so reading them costs
+     * nothing. They are not updated when the document is changed after
+     * loading. Use SSXMLElement::statistics() to get the current values.
+     * @since 1.1
+     **/
+    const SSXMLStatistics& loadStatistics() const;
+    /*}}}*/
 
 public:     // Read Operations
     // error_t open(const QString &fileName, const char *encoding = NULL);/*{{{*/
@@ -94,6 +136,8 @@ public:     // Read Operations
      *      closed correctly.
      * - \b SSE_FAULT: Any other kind of error.
      * .
+     * @remarks Data compressed in \e gzip format is recognized and
+     * decompressed while the document is parsed.
      * @sa ssqt_errors
      * @since 1.1
      **/
@@ -117,6 +161,8 @@ public:     // Read Operations
      *      closed correctly.
      * - \b SSE_FAULT: Any other kind of error.
      * .
+     * @remarks Data compressed in \e gzip format is recognized and
+     * decompressed while the document is parsed.
      * @sa ssqt_errors
      * @since 1.1
      **/
@@ -140,11 +186,65 @@ public:     // Read Operations
      *      closed correctly.
      * - \b SSE_FAULT: Any other kind of error.
      * .
+     * @remarks Data compressed in \e gzip format is recognized and
+     * decompressed while the document is parsed.
      * @sa ssqt_errors
      * @since 1.1
      **/
     error_t open(const QByteArray &byteArray, const char *encoding = NULL);
     /*}}}*/
+    // error_t open(const QString &fileName, const QStringList &paths, const char *encoding = NULL);/*{{{*/
+    /**
+     * Loads selected parts of a file from disk or resource.
+     * @param fileName String with absolute file name or resource identifier.
+     * @param paths List of path patterns selecting the subtrees to load.
+     * See #open(QFile&, const QStringList&, const char*).
+     * @param encoding Optional. The character encoding of the file to load.
+     * @return If the function succeeded the result is \b 0 (\c
+     * SSNO_ERROR). Otherwize an error code will be returned. The same of
+     * #open(const QString&, const char*) plus \c SSE_INVAL when a pattern is
+     * not valid.
+     * @since 1.1
+     **/
+    error_t open(const QString &fileName, const QStringList &paths, const char *encoding = NULL);
+    /*}}}*/
+    // error_t open(QFile &file, const QStringList &paths, const char *encoding = NULL);/*{{{*/
+    /**
+     * Loads selected parts of a file from disk or resource.
+     * @param file \c QFile object with the file reference to be loaded.
+     * @param paths List of path patterns selecting the subtrees to load. Each
+     * pattern is an absolute path of element names, like
+     * <tt>"/config/network"</tt>. A step can be \c * to match any name, as
+     * in <tt>"/config/network/\*"</tt>. An element whose path matches
+     * a pattern is loaded with its whole subtree. Its ancestors are loaded
+     * with their attributes. Any other element is skipped by the tokenizer
+     * without building nodes or strings. The root element is always loaded.
+     * An empty list loads the whole document. Up to \c SSXML_MAX_PATHS
+     * patterns can be used.
+     * @param encoding Optional. The character encoding of the file to load.
+     * @return If the function succeeded the result is \b 0 (\c
+     * SSNO_ERROR). Otherwize an error code will be returned. The same of
+     * #open(QFile&, const char*) plus \c SSE_INVAL when a pattern is not
+     * valid.
+     * @since 1.1
+     **/
+    error_t open(QFile &file, const QStringList &paths, const char *encoding = NULL);
+    /*}}}*/
+    // error_t open(const QByteArray &byteArray, const QStringList &paths, const char *encoding = NULL);/*{{{*/
+    /**
+     * Loads selected parts of an XML file from a memory buffer.
+     * @param byteArray \c QByteArray object with XML data in memory.
+     * @param paths List of path patterns selecting the subtrees to load.
+     * See #open(QFile&, const QStringList&, const char*).
+     * @param encoding Optional. The character encoding of the file to load.
+     * @return If the function succeeded the result is \b 0 (\c
+     * SSNO_ERROR). Otherwize an error code will be returned. The same of
+     * #open(const QByteArray&, const char*) plus \c SSE_INVAL when a pattern
+     * is not valid.
+     * @since 1.1
+     **/
+    error_t open(const QByteArray &byteArray, const QStringList &paths, const char *encoding = NULL);
+    /*}}}*/
 
 public:     // Write Operations
     // error_t write(const char *encoding = NULL);/*{{{*/
@@ -182,6 +282,8 @@ public:     // Write Operations
      * class. Some values are listed in the @ref ssqt_encodings group.
      * @return If the function succeeded the result is \b 0 (\c SSNO_ERROR).
      * Otherwize an error code will be returned.
+     * @remarks When \a fileName ends with \c SSGZIP_SUFFIX (".gz") the file
+     * is written compressed in \e gzip format.
      * @sa ssqt_errors
      * @since 1.1
      **/
@@ -199,6 +301,8 @@ public:     // Write Operations
      * class. Some values are listed in the @ref ssqt_encodings group.
      * @return If the function succeeded the result is \b 0 (\c SSNO_ERROR).
      * Otherwize an error code will be returned.
+     * @remarks When the name of \a file ends with \c SSGZIP_SUFFIX (".gz")
+     * the file is written compressed in \e gzip format.
      * @sa ssqt_errors
      * @since 1.1
      **/
@@ -209,8 +313,10 @@ public:     // Write Operations
      * Writes this document data to a device.
      * @param device Pointer to the target device. This can be any device,
      * a socket, a file, even the debugging output device stream is accepted.
-     * The passed object should not be opened. It will be open inside the
-     * function. Also, when writing ends, it will be closed.
+     * When the passed object is not opened, it will be open inside the
+     * function and closed when writing ends. A device already open for
+     * writing is used as is and left open. To write compressed data pass a
+     * \c SSGZipDevice object.
      * @param encoding Optional. The character encoding to be used in the
      * written file.  When \b NULL the enconding will be chosen according to
      * the default locale and machine where the application is running.
@@ -224,6 +330,152 @@ public:     // Write Operations
     error_t write(QIODevice *device, const char *encoding = NULL);
     /*}}}*/
 
+public:     // Operations
+    // error_t compact(SSXMLCompactDocument *document, uint storage = SSXML_STORE_UTF16) const;/*{{{*/
+    /**
+     * Freezes this document in a compact read only representation.
+     * @param document The \c SSXMLCompactDocument that will receive a copy of
+     * this document. Its previous contents are released.
+     * @param storage How values and texts are stored. \c SSXML_STORE_UTF8
+     * halves the memory of ASCII content. See SSXMLCompactDocument::assign().
+     * @return If the function succeeded the result is \b 0 (\c SSNO_ERROR).
+     * Otherwize an error code will be returned. \c SSE_INVAL when \a document
+     * is \b NULL. \c SSE_OVERFLOW when this document is too large.
+     * @remarks Documents that are only read after being loaded, like
+     * configuration files, use much less memory in the compact form. This
+     * document can be released after the operation returns. Compare
+     * #memoryUsage() of this document with SSXMLCompactDocument::memoryUsage()
+     * to measure the saving.
+     * @sa SSXMLCompactDocument
+     * @since 1.1
+     **/
+    error_t compact(SSXMLCompactDocument *document, uint storage = SSXML_STORE_UTF16) const;
+    /*}}}*/
+    // error_t merge(const SSXMLElement *overlay, const QStringList &keys, uint mode = SSXML_MERGE_REPLACE);/*{{{*/
+    /**
+     * Applies an overlay document over this one.
+     * @param overlay Root of the overlay. Must have the same name of this
+     * document root. When this document is empty it becomes a copy of \a
+     * overlay.
+     * @param keys Names of the attributes that identify children, in order
+     * of preference. Usually \c id and \c name.
+     * @param mode How lists of children without keys are handled. \c
+     * SSXML_MERGE_REPLACE or \c SSXML_MERGE_APPEND.
+     * @return \b SSNO_ERROR on success. \b SSE_INVAL when \a overlay is \b
+     * NULL or its name differs from the name of this document root.
+     * @remarks The elements are merged from the root as follows:
+     * - The attributes of the overlay element are set in the base element,
+     *   replacing the existing ones.
+     * - An overlay element with text and no children replaces the text and
+     *   the children of the base element.
+     * - A child with a key attribute is matched with the base child with the
+     *   same name and key value. Matching children are merged. Children
+     *   without a match are copied.
+     * - A child without key whose name appears only once in both elements is
+     *   merged with the base child.
+     * - Other children without key are lists. The overlay copies replace
+     *   the base children with the same name, or are appended to them,
+     *   according to \a mode.
+     * .
+     * Children are matched through hash tables, so the time is linear in the
+     * size of both trees.
+     * @since 1.1
+     **/
+    error_t merge(const SSXMLElement *overlay, const QStringList &keys, uint mode = SSXML_MERGE_REPLACE);
+    /*}}}*/
+    // error_t merge(const QString &fileName, const QStringList &keys, uint mode = SSXML_MERGE_REPLACE);/*{{{*/
+    /**
+     * Loads an overlay file and applies it over this document.
+     * @param fileName Name of the overlay file. Compressed files are
+     * accepted.
+     * @param keys Names of the attributes that identify children.
+     * @param mode How lists of children without keys are handled.
+     * @return \b SSNO_ERROR on success. Errors of #open() when the file can't
+     * be loaded. Otherwise the same of #merge(const SSXMLElement*, const
+     * QStringList&, uint).
+     * @since 1.1
+     **/
+    error_t merge(const QString &fileName, const QStringList &keys, uint mode = SSXML_MERGE_REPLACE);
+    /*}}}*/
+
+public:     // Attribute Index
+    // void addIndex(const QString &attrName);/*{{{*/
+    /**
+     * Indexes the elements of this document by an attribute.
+     * @param attrName Name of the attribute. Usually \c id or \c name.
+     * @remarks The index is built here, walking the whole document. After
+     * that it is kept up to date by the changes made through SSXMLElement
+     * member functions in any element of this document. Loading the
+     * document builds it again once the load is done. Lookups never change
+     * the index, so they can run from several threads while the document
+     * is not changed.
+     * @since 1.1
+     **/
+    void addIndex(const QString &attrName);
+    /*}}}*/
+    // void removeIndex(const QString &attrName);/*{{{*/
+    /**
+     * Removes an index added with #addIndex().
+     * @param attrName Name of the attribute.
+     * @since 1.1
+     **/
+    void removeIndex(const QString &attrName);
+    /*}}}*/
+    // bool isIndexed(const QString &attrName) const;/*{{{*/
+    /**
+     * Checks whether an attribute was passed to #addIndex().
+     * @since 1.1
+     **/
+    bool isIndexed(const QString &attrName) const;
+    /*}}}*/
+    // SSXMLElement* elementWith(const QString &attrName, const QString &value) const;/*{{{*/
+    /**
+     * Finds an element by the value of an attribute.
+     * @param attrName Name of the attribute.
+     * @param value Value of the attribute.
+     * @returns An element of this document, this document included, with
+     * the attribute \a attrName equal to \a value. \b NULL when there is
+     * none. When there are several, the first in document order.
+     * @remarks When \a attrName is not indexed the tree is walked.
+     * @since 1.1
+     **/
+    SSXMLElement* elementWith(const QString &attrName, const QString &value) const;
+    /*}}}*/
+    // QList<SSXMLElement*> elementsWith(const QString &attrName, const QString &value) const;/*{{{*/
+    /**
+     * Finds all elements with an attribute value.
+     * @param attrName Name of the attribute.
+     * @param value Value of the attribute.
+     * @returns The list of elements found, in document order.
+     * @remarks When \a attrName is not indexed the tree is walked.
+     * @since 1.1
+     **/
+    QList<SSXMLElement*> elementsWith(const QString &attrName, const QString &value) const;
+    /*}}}*/
+
+public:     // Journal
+    // void journal(SSXMLJournal *journal);/*{{{*/
+    /**
+     * Sets the journal that records the changes made to this document.
+     * @param journal The journal. \b NULL stops recording. The journal is
+     * not owned by the document. Its previous document, if any, stops using
+     * it.
+     * @remarks Changes made through SSXMLElement member functions in any
+     * element of this document are recorded. Loading or assigning the
+     * document are not recorded. They clear the journal instead.
+     * @since 1.1
+     **/
+    void journal(SSXMLJournal *journal);
+    /*}}}*/
+    // SSXMLJournal* journal() const;/*{{{*/
+    /**
+     * The journal that records the changes made to this document.
+     * @returns The journal set with #journal(SSXMLJournal*) or \b NULL.
+     * @since 1.1
+     **/
+    SSXMLJournal* journal() const;
+    /*}}}*/
+
 public:     // Overloaded Operators
     // SSXMLDocument& operator=(const SSXMLDocument &document);/*{{{*/
     /**
@@ -237,35 +489,72 @@ public:     // Overloaded Operators
 
 public:     // Data Members
     QString fileName;               /**< Original file name.    */
+
+protected:
+    virtual void changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);
+    virtual void released(SSXMLElement *element, bool owned);
+    void buildIndex();
+    void indexTree(SSXMLElement *element, bool add, bool ordered);
+    void resetIndex();
+
+protected:
+    SSXMLStatistics m_stats;        /**< Load statistics.       */
+    QStringList     m_indexed;      /**< Indexed attributes.    */
+    QHash<QString, QHash<QString, QList<SSXMLElement*> > > m_indexes; /**< Index by value, in document order. */
+    bool            m_indexBuilt;   /**< Index is up to date.   */
+    SSXMLJournal   *m_journal;      /**< Journal of changes.    */
 };
 /* Inline Functions {{{ */
 /* ------------------------------------------------------------------------ */
 /*! \name Constructors & Destructor *//*{{{*/ //@{
 /* ------------------------------------------------------------------------ */
 // inline SSXMLDocument::SSXMLDocument();/*{{{*/
-inline SSXMLDocument::SSXMLDocument() : SSXMLElement() { }
+inline SSXMLDocument::SSXMLDocument() : SSXMLElement(), m_indexBuilt(false), m_journal(NULL) { }
 /*}}}*/
 // inline SSXMLDocument::SSXMLDocument(const QString &fileName);/*{{{*/
-inline SSXMLDocument::SSXMLDocument(const QString &fileName) : SSXMLElement() {
+inline SSXMLDocument::SSXMLDocument(const QString &fileName) : SSXMLElement(), m_indexBuilt(false), m_journal(NULL) {
     open(fileName);
 }
 /*}}}*/
 // inline SSXMLDocument::SSXMLDocument(QFile &file);/*{{{*/
-inline SSXMLDocument::SSXMLDocument(QFile &file) : SSXMLElement() {
+inline SSXMLDocument::SSXMLDocument(QFile &file) : SSXMLElement(), m_indexBuilt(false), m_journal(NULL) {
     open(file);
 }
 /*}}}*/
 // inline SSXMLDocument::SSXMLDocument(const QByteArray &byteArray);/*{{{*/
-inline SSXMLDocument::SSXMLDocument(const QByteArray &byteArray) : SSXMLElement() {
+inline SSXMLDocument::SSXMLDocument(const QByteArray &byteArray) : SSXMLElement(), m_indexBuilt(false), m_journal(NULL) {
     open(byteArray);
 }
 /*}}}*/
 // inline SSXMLDocument::SSXMLDocument(const SSXMLDocument &document);/*{{{*/
-inline SSXMLDocument::SSXMLDocument(const SSXMLDocument &document) : SSXMLElement() {
+inline SSXMLDocument::SSXMLDocument(const SSXMLDocument &document) : SSXMLElement(), m_indexBuilt(false), m_journal(NULL) {
     this->operator=(document);
 }
 /*}}}*/
 ///@} Constructors & Destructor /*}}}*/
 /* ------------------------------------------------------------------------ */
+/*! \name Attributes *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline const SSXMLStatistics& SSXMLDocument::loadStatistics() const;/*{{{*/
+inline const SSXMLStatistics& SSXMLDocument::loadStatistics() const {
+    return m_stats;
+}
+/*}}}*/
+// inline bool SSXMLDocument::isIndexed(const QString &attrName) const;/*{{{*/
+inline bool SSXMLDocument::isIndexed(const QString &attrName) const {
+    return m_indexed.contains(attrName);
+}
+/*}}}*/
+///@} Attributes /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name Journal *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLJournal* SSXMLDocument::journal() const;/*{{{*/
+inline SSXMLJournal* SSXMLDocument::journal() const {
+    return m_journal;
+}
+/*}}}*/
+///@} Journal /*}}}*/
+/* ------------------------------------------------------------------------ */
 /* }}} Inline Functions */
 #endif /* __SSQTXMLD_HPP_DEFINED__ */
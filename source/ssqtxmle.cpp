@@ -16,10 +16,80 @@
 #include "stdplx.hpp"
 #include "ssqtcmn.hpp"
 #include "ssqtxmle.hpp"
+#include <QSet>
+#include <QMutex>
+
+/**
+ * @internal
+ * Characters escaped by \c __xml_escape() besides '&', '<' and '>'.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_ESCAPE_QUOTES 0x0001  /**< Double quotes.                     */
+#define SSXML_ESCAPE_SPACES 0x0002  /**< Tabs, line feeds and returns.      */
+///@}
+
+/**
+ * @internal
+ * Serializes the builds of the indexes of names made by searches.
+ **/
+Q_GLOBAL_STATIC(QMutex, __xml_namesLock)
 
 /* ===========================================================================
  * SSXMLElement class
  * ======================================================================== */
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static size_t __xml_escapedLength(const QString &value, uint escape);/*{{{*/
+/**
+ * Computes the length of a string after escaping.
+ * @param value String to be escaped.
+ * @param escape Characters escaped besides the always escaped ones. A
+ * combination of \c SSXML_ESCAPE_QUOTES and \c SSXML_ESCAPE_SPACES.
+ * @returns The number of characters \c __xml_escape() will append.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static size_t __xml_escapedLength(const QString &value, uint escape);
+/*}}}*/
+// static void __xml_escape(QString &buffer, const QString &value, uint escape);/*{{{*/
+/**
+ * Appends a string to a buffer escaping XML special characters.
+ * @param buffer The target buffer.
+ * @param value String to be escaped.
+ * @param escape Characters escaped besides '&', '<' and '>'. A combination
+ * of \c SSXML_ESCAPE_QUOTES and \c SSXML_ESCAPE_SPACES.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static void __xml_escape(QString &buffer, const QString &value, uint escape);
+/*}}}*/
+// static bool __xml_lessThan(const QHash<QString, QString>::const_iterator &a, const QHash<QString, QString>::const_iterator &b);/*{{{*/
+/**
+ * Orders attributes by name.
+ * Used to sort attributes when \c SSXML_SORTED is set.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+static bool __xml_lessThan(const QHash<QString, QString>::const_iterator &a, const QHash<QString, QString>::const_iterator &b);
+/*}}}*/
+
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLKeys */ //@{
+/* ------------------------------------------------------------------------ */
+const SSXMLKey SSXMLKeys::menuItem(SS_MENU_NODE_ITEM);
+const SSXMLKey SSXMLKeys::menuSeparator(SS_MENU_NODE_SEPARATOR);
+const SSXMLKey SSXMLKeys::menuPopup(SS_MENU_NODE_POPUP);
+const SSXMLKey SSXMLKeys::menuMenu(SS_MENU_NODE_MENU);
+const SSXMLKey SSXMLKeys::attrId(SS_MENU_ATTR_ID);
+const SSXMLKey SSXMLKeys::attrName(SS_MENU_ATTR_NAME);
+const SSXMLKey SSXMLKeys::attrText(SS_MENU_ATTR_TEXT);
+const SSXMLKey SSXMLKeys::attrDesc(SS_MENU_ATTR_DESC);
+const SSXMLKey SSXMLKeys::attrKeys(SS_MENU_ATTR_KEYS);
+const SSXMLKey SSXMLKeys::attrIcon(SS_MENU_ATTR_ICON);
+const SSXMLKey SSXMLKeys::attrChecked(SS_MENU_ATTR_CHECKED);
+const SSXMLKey SSXMLKeys::attrDefault(SS_MENU_ATTR_DEFAULT);
+const SSXMLKey SSXMLKeys::attrRef(SS_MENU_ATTR_REF);
+const SSXMLKey SSXMLKeys::nodeToolbar(SS_XML_NODE_TOOLBAR);
+const SSXMLKey SSXMLKeys::nodeButton(SS_XML_NODE_BUTTON);
+const SSXMLKey SSXMLKeys::attrEnabled(SS_XML_ATTR_ENABLED);
+///@} SSXMLKeys
 
 /* ------------------------------------------------------------------------ */
 /*! \name Attributes Operations */ //@{
@@ -33,17 +103,27 @@ QString SSXMLElement::attribute(const QString &attrName) const
 // int     SSXMLElement::intValueOf(const QString &attrName, int defaultValue = 0) const;/*{{{*/
 int SSXMLElement::intValueOf(const QString &attrName, int defaultValue) const
 {
-    QString value = attribute(attrName);
+    return intValue(attribute(attrName), defaultValue);
+}
+/*}}}*/
+// bool    SSXMLElement::boolValueOf(const QString &attrName, bool defaultValue = false) const;/*{{{*/
+bool SSXMLElement::boolValueOf(const QString &attrName, bool defaultValue) const
+{
+    return boolValue(attribute(attrName), defaultValue);
+}
+/*}}}*/
+// int SSXMLElement::intValue(const QString &value, int defaultValue = 0);/*{{{*/
+int SSXMLElement::intValue(const QString &value, int defaultValue)
+{
     bool success  = true;
     int  result   = value.toInt(&success, 0);
 
     return (success ? result : defaultValue);
 }
 /*}}}*/
-// bool    SSXMLElement::boolValueOf(const QString &attrName, bool defaultValue = false) const;/*{{{*/
-bool SSXMLElement::boolValueOf(const QString &attrName, bool defaultValue) const
+// bool SSXMLElement::boolValue(const QString &value, bool defaultValue = false);/*{{{*/
+bool SSXMLElement::boolValue(const QString &value, bool defaultValue)
 {
-    QString value = attribute(attrName);
     bool   result = defaultValue;
 
     if ((value == "true") || (value == "yes") || (value.toInt() != 0))
@@ -57,7 +137,25 @@ bool SSXMLElement::boolValueOf(const QString &attrName, bool defaultValue) const
 // SSXMLElement& SSXMLElement::set(const QString &attrName, const QString &attrValue);/*{{{*/
 SSXMLElement& SSXMLElement::set(const QString &attrName, const QString &attrValue)
 {
-    m_attrs[attrName] = attrValue;
+    if (!watched())
+    {
+        m_attrs[attrName] = attrValue;
+        return *this;
+    }
+
+    QHash<QString, QString>::iterator it = m_attrs.find(attrName);
+    if (it == m_attrs.end())
+    {
+        m_attrs.insert(attrName, attrValue);
+        notify(SSXML_ATTRIBUTE_CHANGED, this, -1, attrName, NULL);
+    }
+    else
+    {
+        QString previous = it.value();
+
+        it.value() = attrValue;
+        notify(SSXML_ATTRIBUTE_CHANGED, this, -1, attrName, &previous);
+    }
     return *this;
 }
 /*}}}*/
@@ -76,13 +174,46 @@ SSXMLElement& SSXMLElement::set(const QString &attrName, const bool &attrValue)
 // QString SSXMLElement::remove(const QString &attrName);/*{{{*/
 QString SSXMLElement::remove(const QString &attrName)
 {
-    return m_attrs.take(attrName);
+    if (!watched())
+        return m_attrs.take(attrName);
+
+    QHash<QString, QString>::iterator it = m_attrs.find(attrName);
+    if (it == m_attrs.end())
+        return QString();
+
+    QString previous = it.value();
+
+    m_attrs.erase(it);
+    notify(SSXML_ATTRIBUTE_REMOVED, this, -1, attrName, &previous);
+
+    return previous;
 }
 /*}}}*/
 // void SSXMLElement::removeAllAttributes();/*{{{*/
 void SSXMLElement::removeAllAttributes()
 {
-    m_attrs.clear();
+    if (!watched() || m_attrs.isEmpty())
+    {
+        m_attrs.clear();
+        return;
+    }
+
+    QHash<QString, QString> previous;
+
+    previous.swap(m_attrs);
+
+    QHash<QString, QString>::const_iterator it = previous.cbegin();
+    while (it != previous.cend())
+    {
+        notify(SSXML_ATTRIBUTE_REMOVED, this, -1, it.key(), &it.value());
+        ++it;
+    }
+}
+/*}}}*/
+// void SSXMLElement::reserveAttributes(uint count);/*{{{*/
+void SSXMLElement::reserveAttributes(uint count)
+{
+    m_attrs.reserve((int)count);
 }
 /*}}}*/
 ///@} Attributes Operations
@@ -116,6 +247,61 @@ SSXMLElement* SSXMLElement::lastElement() const
     return elementAt(m_nodes.count() - 1);
 }
 /*}}}*/
+// SSXMLElement* SSXMLElement::firstChild(const QString &name) const;/*{{{*/
+SSXMLElement* SSXMLElement::firstChild(const QString &name) const
+{
+    const QList<SSXMLElement*> *list;
+
+    if (named(name, &list))
+        return (list ? list->first() : NULL);
+
+    size_t limit = m_nodes.count();
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if (m_nodes.at(i)->elementName == name)
+            return m_nodes.at(i);
+    }
+    return NULL;
+}
+/*}}}*/
+// QList<SSXMLElement*> SSXMLElement::children(const QString &name) const;/*{{{*/
+QList<SSXMLElement*> SSXMLElement::children(const QString &name) const
+{
+    const QList<SSXMLElement*> *found;
+
+    if (named(name, &found))
+        return (found ? *found : QList<SSXMLElement*>());
+
+    QList<SSXMLElement*> list;
+    size_t limit = m_nodes.count();
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if (m_nodes.at(i)->elementName == name)
+            list.append(m_nodes.at(i));
+    }
+    return list;
+}
+/*}}}*/
+// size_t SSXMLElement::countChildren(const QString &name) const;/*{{{*/
+size_t SSXMLElement::countChildren(const QString &name) const
+{
+    const QList<SSXMLElement*> *list;
+
+    if (named(name, &list))
+        return (list ? list->count() : 0);
+
+    size_t limit = m_nodes.count();
+    size_t count = 0;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if (m_nodes.at(i)->elementName == name)
+            count++;
+    }
+    return count;
+}
+/*}}}*/
 // SSXMLElement& SSXMLElement::append(const SSXMLElement &element);/*{{{*/
 SSXMLElement& SSXMLElement::append(const SSXMLElement &element)
 {
@@ -128,39 +314,273 @@ SSXMLElement& SSXMLElement::append(SSXMLElement *element)
 {
     if (element != NULL)
     {
+        clearText();                /* Children has priority over text. */
+
         element->parentElement = this;
         m_nodes.append(element);
+        if (element->m_watched != m_watched) element->watchTree(m_watched);
+
+        addName(element);
+        notify(SSXML_CHILD_ADDED, element, m_nodes.count() - 1, QString(), NULL);
     }
     return *this;
 }
 /*}}}*/
+// SSXMLElement& SSXMLElement::append(const QList<SSXMLElement*> &elements);/*{{{*/
+SSXMLElement& SSXMLElement::append(const QList<SSXMLElement*> &elements)
+{
+    size_t limit = elements.count();
+    SSXMLElement *node;
+
+    m_nodes.reserve(m_nodes.count() + (int)limit);
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if ((node = elements.at(i)) == NULL)
+            continue;
+
+        clearText();                /* Children has priority over text. */
+
+        node->parentElement = this;
+        m_nodes.append(node);
+        if (node->m_watched != m_watched) node->watchTree(m_watched);
+
+        addName(node);
+        notify(SSXML_CHILD_ADDED, node, m_nodes.count() - 1, QString(), NULL);
+    }
+    return *this;
+}
+/*}}}*/
+// void SSXMLElement::reserveChildren(uint count);/*{{{*/
+void SSXMLElement::reserveChildren(uint count)
+{
+    m_nodes.reserve((int)count);
+}
+/*}}}*/
 // bool SSXMLElement::remove(const SSXMLElement *element);/*{{{*/
 bool SSXMLElement::remove(const SSXMLElement *element)
 {
     int index = indexOf(element);
     if (index < 0) return false;
 
-    m_nodes.removeAt(index);
+    notify(SSXML_CHILD_REMOVED, m_nodes.at(index), index, QString(), NULL);
+    removeName(m_nodes.at(index));
+
+    SSXMLElement *node = m_nodes.takeAt(index);
+    node->parentElement = NULL;
+    release(node, false);
+    if (node->m_watched) node->watchTree(false);
     return true;
 }
 /*}}}*/
+// SSXMLElement* SSXMLElement::take(uint index);/*{{{*/
+SSXMLElement* SSXMLElement::take(uint index)
+{
+    if (index >= (uint)m_nodes.count())
+        return NULL;
+
+    notify(SSXML_CHILD_REMOVED, m_nodes.at(index), (int)index, QString(), NULL);
+    removeName(m_nodes.at(index));
+
+    SSXMLElement *element = m_nodes.takeAt(index);
+    element->parentElement = NULL;
+    release(element, false);
+    if (element->m_watched) element->watchTree(false);
+
+    return element;
+}
+/*}}}*/
+// SSXMLElement& SSXMLElement::insert(uint index, const SSXMLElement &element);/*{{{*/
+SSXMLElement& SSXMLElement::insert(uint index, const SSXMLElement &element)
+{
+    SSXMLElement *node = new SSXMLElement(element, this);
+    return insert(index, node);
+}
+/*}}}*/
+// SSXMLElement& SSXMLElement::insert(uint index, SSXMLElement *element);/*{{{*/
+SSXMLElement& SSXMLElement::insert(uint index, SSXMLElement *element)
+{
+    if (element != NULL)
+    {
+        if (index > (uint)m_nodes.count())
+            index = m_nodes.count();
+
+        clearText();                /* Children has priority over text. */
+
+        element->parentElement = this;
+        m_nodes.insert(index, element);
+        if (element->m_watched != m_watched) element->watchTree(m_watched);
+
+        addNames(index, QList<SSXMLElement*>() << element);
+
+        notify(SSXML_CHILD_ADDED, element, (int)index, QString(), NULL);
+    }
+    return *this;
+}
+/*}}}*/
+// size_t SSXMLElement::splice(uint index, SSXMLElement *source, uint first = 0, uint count = ~0U);/*{{{*/
+size_t SSXMLElement::splice(uint index, SSXMLElement *source, uint first, uint count)
+{
+    if ((source == NULL) || (source == this))
+        return 0;
+
+    uint available = source->m_nodes.count();
+    if (first >= available) return 0;
+    if (count > (available - first))
+        count = available - first;
+
+    /* An element cannot be moved into its own subtree. Only one ancestor of
+     * this element can be a child of 'source'. */
+    for (SSXMLElement *node = this; node->parentElement != NULL; node = node->parentElement)
+    {
+        if (node->parentElement != source)
+            continue;
+
+        int position = source->indexOf(node);
+        if ((position >= (int)first) && (position < (int)(first + count)))
+            return 0;
+        break;
+    }
+
+    /* Reported from the last, so each index is valid when the previous
+     * elements are removed one by one. */
+    if (source->watched())
+    {
+        for (uint i = count; i > 0; --i)
+            source->notify(SSXML_CHILD_REMOVED, source->m_nodes.at(first + i - 1), (int)(first + i - 1), QString(), NULL);
+    }
+
+    clearText();                    /* Children has priority over text. */
+
+    QList<SSXMLElement*> moved = source->m_nodes.mid(first, count);
+    QSet<const SSXMLElement*> leaving;
+
+    for (uint i = 0; i < count; ++i)
+        leaving.insert(moved.at(i));
+
+    source->removeNames(leaving);
+    source->m_nodes.erase(source->m_nodes.begin() + first, source->m_nodes.begin() + (first + count));
+
+    for (uint i = 0; i < count; ++i)
+    {
+        SSXMLElement *node = moved.at(i);
+
+        node->parentElement = NULL;
+        source->release(node, false);
+
+        node->parentElement = this;
+        if (node->m_watched != m_watched) node->watchTree(m_watched);
+    }
+
+    if (index > (uint)m_nodes.count())
+        index = m_nodes.count();
+
+    if (index == (uint)m_nodes.count())
+        m_nodes.append(moved);
+    else
+    {
+        QList<SSXMLElement*> nodes;
+
+        nodes.reserve(m_nodes.count() + count);
+        nodes.append(m_nodes.mid(0, index));
+        nodes.append(moved);
+        nodes.append(m_nodes.mid(index));
+        m_nodes.swap(nodes);
+    }
+
+    addNames(index, moved);
+
+    if (watched())
+    {
+        for (uint i = 0; i < count; ++i)
+            notify(SSXML_CHILD_ADDED, moved.at(i), (int)(index + i), QString(), NULL);
+    }
+    return count;
+}
+/*}}}*/
 // bool SSXMLElement::remove(uint index);/*{{{*/
 bool SSXMLElement::remove(uint index)
 {
     if (index >= (uint)m_nodes.count())
         return false;
 
+    notify(SSXML_CHILD_REMOVED, m_nodes.at(index), (int)index, QString(), NULL);
+    removeName(m_nodes.at(index));
+
     SSXMLElement *element = m_nodes.takeAt(index);
-    delete element;
+    element->parentElement = NULL;
+    release(element, true);
 
     return true;
 }
 /*}}}*/
+// size_t SSXMLElement::removeElements(const QList<SSXMLElement*> &elements);/*{{{*/
+size_t SSXMLElement::removeElements(const QList<SSXMLElement*> &elements)
+{
+    QSet<const SSXMLElement*> removed;
+    size_t limit = elements.count();
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if ((elements.at(i) != NULL) && (elements.at(i)->parentElement == this))
+            removed.insert(elements.at(i));
+    }
+    if (removed.isEmpty()) return 0;
+
+    /* Reported from the last, so each index is valid when the previous
+     * elements are removed one by one. */
+    limit = m_nodes.count();
+    if (watched())
+    {
+        for (size_t i = limit; i > 0; --i)
+        {
+            if (removed.contains(m_nodes.at(i - 1)))
+                notify(SSXML_CHILD_REMOVED, m_nodes.at(i - 1), (int)(i - 1), QString(), NULL);
+        }
+    }
+
+    QList<SSXMLElement*> nodes;
+    SSXMLElement *node;
+
+    removeNames(removed);              /* Before they are deleted. */
+
+    nodes.reserve((int)limit - removed.count());
+    for (size_t i = 0; i < limit; ++i)
+    {
+        node = m_nodes.at(i);
+        if (!removed.contains(node))
+            nodes.append(node);
+        else
+        {
+            node->parentElement = NULL;
+            release(node, true);
+        }
+    }
+    m_nodes.swap(nodes);
+
+    return removed.count();
+}
+/*}}}*/
 // void SSXMLElement::removeAllElements();/*{{{*/
 void SSXMLElement::removeAllElements()
 {
-    qDeleteAll(m_nodes);
+    if (!watched())
+        qDeleteAll(m_nodes);
+    else
+    {
+        size_t limit = m_nodes.count();
+
+        for (size_t i = limit; i > 0; --i)
+            notify(SSXML_CHILD_REMOVED, m_nodes.at(i - 1), (int)(i - 1), QString(), NULL);
+
+        for (size_t i = 0; i < limit; ++i)
+        {
+            m_nodes.at(i)->parentElement = NULL;
+            release(m_nodes.at(i), true);
+        }
+    }
     m_nodes.clear();
+    dropNames();
 }
 /*}}}*/
 ///@} Child Element Operations
@@ -186,21 +606,48 @@ bool SSXMLElement::isEqualTo(const SSXMLElement *element) const
     if (m_attrs != element->m_attrs)
         return false;
 
-    return (m_nodes == element->m_nodes);
+    if (text() != element->text())
+        return false;
+
+    /* Children are compared by content. Their pointers are never the same. */
+    size_t limit = numberOfChildren();
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if (!m_nodes.at(i)->isEqualTo(element->m_nodes.at(i)))
+            return false;
+    }
+    return true;
 }
 /*}}}*/
 // void SSXMLElement::assign(const SSXMLElement *element);/*{{{*/
 void SSXMLElement::assign(const SSXMLElement *element)
 {
     elementName = element->elementName;
-    m_attrs     = element->m_attrs;
+
+    if (!watched())
+        m_attrs = element->m_attrs;
+    else
+    {
+        removeAllAttributes();
+        m_attrs = element->m_attrs;
+
+        QHash<QString, QString>::const_iterator it = m_attrs.cbegin();
+        while (it != m_attrs.cend())
+        {
+            notify(SSXML_ATTRIBUTE_CHANGED, this, -1, it.key(), NULL);
+            ++it;
+        }
+    }
 
     /* The child element list must be duplicated. */
-    qDeleteAll(m_nodes);
-    m_nodes.clear();
+    removeAllElements();
+
+    if (m_text != element->m_text)
+        text(element->m_text);
 
     size_t limit = element->numberOfChildren();
 
+    m_nodes.reserve((int)limit);
     for (size_t i = 0; i < limit; ++i)
         append( *(element->elementAt(i)) );
 }
@@ -213,77 +660,648 @@ QString SSXMLElement::toString() const
 /*}}}*/
 // QString SSXMLElement::toString(uint indent) const;/*{{{*/
 QString SSXMLElement::toString(uint indent) const
+{
+    return toString(indent, SSXML_INDENT_WIDTH, 0);
+}
+/*}}}*/
+// QString SSXMLElement::toString(uint indent, uint width, uint flags) const;/*{{{*/
+QString SSXMLElement::toString(uint indent, uint width, uint flags) const
 {
     QString xmlElement;
 
-    if (indent > 0) xmlElement.fill(' ', indent * 2);
+    xmlElement.reserve((int)printLength(indent, width, flags));
+    print(xmlElement, NULL, indent, width, flags);
+
+    return xmlElement;
+}
+/*}}}*/
+// bool SSXMLElement::print(QTextStream &stream, uint indent = 0, uint width = SSXML_INDENT_WIDTH, uint flags = 0) const;/*{{{*/
+bool SSXMLElement::print(QTextStream &stream, uint indent, uint width, uint flags) const
+{
+    QString buffer;
+
+    buffer.reserve(SSXML_PRINT_BLOCK + SSXML_PRINT_BLOCK / 4);
+    print(buffer, &stream, indent, width, flags);
 
-    xmlElement.append(QString("<%1").arg(elementName));
+    stream << buffer;
+    return (stream.status() == QTextStream::Ok);
+}
+/*}}}*/
+// size_t SSXMLElement::printLength(uint indent = 0, uint width = SSXML_INDENT_WIDTH, uint flags = 0) const;/*{{{*/
+size_t SSXMLElement::printLength(uint indent, uint width, uint flags) const
+{
+    uint   escape     = ((flags & SSXML_NORMALIZED) ? SSXML_ESCAPE_SPACES : 0);
+    size_t nameLength = elementName.length();
+    size_t spaces     = ((flags & SSXML_COMPACT) ? 0 : indent * width);
+    size_t lineBreak  = ((flags & SSXML_COMPACT) ? 0 : 1);
+    size_t length     = spaces + 1 + nameLength;      /* <name */
 
-    QString attrFormat(" %1=\"%2\"");
     QHash<QString, QString>::const_iterator it = m_attrs.cbegin();
     while (it != m_attrs.cend())
     {
-        xmlElement.append(attrFormat.arg(it.key(), it.value()));
+        /* ' name="value"' */
+        length += it.key().length() + __xml_escapedLength(it.value(), escape | SSXML_ESCAPE_QUOTES) + 4;
         ++it;
     }
 
-    if (m_nodes.empty())
-        xmlElement.append("/>\n");
-    else
+    QString text = ((flags & SSXML_NORMALIZED) ? m_text.simplified() : m_text);
+
+    if (!m_nodes.isEmpty())
     {
         size_t limit = m_nodes.count();
-        SSXMLElement *node;
 
-        xmlElement.append(">\n");
+        length += 1 + lineBreak;                    /* > */
         for (size_t i = 0; i < limit; ++i)
-        {
-            node = m_nodes.at(i);
-            xmlElement.append(node->toString(indent + 1));
-        }
-        xmlElement.append(QString("</%1>\n").arg(elementName));
+            length += m_nodes.at(i)->printLength(indent + 1, width, flags);
+        length += spaces + nameLength + 3;          /* </name> */
     }
-    return xmlElement;
+    else if (!text.isEmpty())
+        length += __xml_escapedLength(text, 0) + nameLength + 4;
+    else if (flags & SSXML_NORMALIZED)
+        length += nameLength + 4;                   /* ></name> */
+    else
+        length += 2;                                /* /> */
+
+    return (length + lineBreak);
+}
+/*}}}*/
+// QByteArray SSXMLElement::canonical() const;/*{{{*/
+QByteArray SSXMLElement::canonical() const
+{
+    return toString(0, 0, SSXML_CANONICAL).toUtf8();
 }
 /*}}}*/
 // bool SSXMLElement::write(QIODevice *device);/*{{{*/
 bool SSXMLElement::write(QIODevice *device)
 {
-    QString xml(QString("<%1").arg(elementName));
+    QTextStream stream(device);
+
+    stream.setCodec(SSENC_UTF8);
+    print(stream, 0, 0, SSXML_COMPACT | SSXML_SORTED);
+    stream.flush();
+
+    return (stream.status() == QTextStream::Ok);
+}
+/*}}}*/
+///@} Overridable Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Statistics */ //@{
+/* ------------------------------------------------------------------------ */
+// size_t SSXMLElement::memoryUsage() const;/*{{{*/
+size_t SSXMLElement::memoryUsage() const
+{
+    SSXMLStatistics stats;
+
+    statistics(&stats, 1);
+    return stats.totalBytes();
+}
+/*}}}*/
+// void SSXMLElement::statistics(SSXMLStatistics *stats) const;/*{{{*/
+void SSXMLElement::statistics(SSXMLStatistics *stats) const
+{
+    if (stats) statistics(stats, 1);
+}
+/*}}}*/
+// void SSXMLElement::statistics(SSXMLStatistics *stats, size_t depth) const;/*{{{*/
+/**
+ * Adds the statistics of this element and its descendants.
+ * @param stats Object receiving the statistics. Cannot be \b NULL.
+ * @param depth Level of this element in the tree.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::statistics(SSXMLStatistics *stats, size_t depth) const
+{
+    stats->elements++;
+    stats->attributes += m_attrs.count();
+    stats->nameBytes  += SSXMLStatistics::stringBytes(elementName.length());
+    stats->textBytes  += SSXMLStatistics::stringBytes(m_text.length());
+    stats->overheadBytes += sizeof(SSXMLElement);
+    stats->overheadBytes += SSXMLStatistics::listBytes(m_nodes.count());
+    stats->overheadBytes += SSXMLStatistics::hashBytes(m_attrs.count(), m_attrs.capacity());
+
+    const QHash<QString, QList<SSXMLElement*> > *names = m_names.load();
+    if (names)
+    {
+        stats->overheadBytes += SSXMLStatistics::hashBytes(names->count(), names->capacity());
+        stats->overheadBytes += SSXMLStatistics::listBytes(m_nodes.count());
+    }
+
+    if (depth > stats->maxDepth)
+        stats->maxDepth = depth;
+
+    QHash<QString, QString>::const_iterator it = m_attrs.cbegin();
+    while (it != m_attrs.cend())
+    {
+        stats->nameBytes  += SSXMLStatistics::stringBytes(it.key().length());
+        stats->valueBytes += SSXMLStatistics::stringBytes(it.value().length());
+        ++it;
+    }
+
+    size_t limit = m_nodes.count();
+    for (size_t i = 0; i < limit; ++i)
+        m_nodes.at(i)->statistics(stats, depth + 1);
+}
+/*}}}*/
+///@} Statistics
+
+/* ------------------------------------------------------------------------ */
+/*! \name Change Notification */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLElement::changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);/*{{{*/
+void SSXMLElement::changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous)
+{
+    Q_UNUSED(change);
+    Q_UNUSED(element);
+    Q_UNUSED(index);
+    Q_UNUSED(name);
+    Q_UNUSED(previous);
+}
+/*}}}*/
+// void SSXMLElement::released(SSXMLElement *element, bool owned);/*{{{*/
+void SSXMLElement::released(SSXMLElement *element, bool owned)
+{
+    Q_UNUSED(element);
+    Q_UNUSED(owned);
+}
+/*}}}*/
+// void SSXMLElement::release(SSXMLElement *element, bool owned);/*{{{*/
+/**
+ * Reports a child that left the list of children of this element.
+ * @param element The child, already detached.
+ * @param owned \b true when the child is deleted by this call. \b false
+ * when the caller keeps it.
+ * @remarks The root of the tree is told with #released() only when the tree
+ * is watched.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::release(SSXMLElement *element, bool owned)
+{
+    if (watched())
+    {
+        SSXMLElement *root = this;
+        while (root->parentElement) root = root->parentElement;
+
+        root->released(element, owned);
+    }
+    if (owned) delete element;
+}
+/*}}}*/
+// void SSXMLElement::watch(bool enable);/*{{{*/
+void SSXMLElement::watch(bool enable)
+{
+    if (enable)
+    {
+        if (m_watchers++ == 0) watchTree(true);
+    }
+    else if ((m_watchers > 0) && (--m_watchers == 0))
+        watchTree(false);
+}
+/*}}}*/
+// void SSXMLElement::watchTree(bool watched);/*{{{*/
+/**
+ * Marks this element and all its descendants as watched or not.
+ * @param watched \b true when the tree is watched.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::watchTree(bool watched)
+{
+    size_t limit = m_nodes.count();
+
+    m_watched = watched;
+    for (size_t i = 0; i < limit; ++i)
+        m_nodes.at(i)->watchTree(watched);
+}
+/*}}}*/
+///@} Change Notification
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// bool SSXMLElement::named(const QString &name, const QList<SSXMLElement*> **list) const;/*{{{*/
+/**
+ * Looks up children in the index of names.
+ * The index is built here when it doesn't exist and there are at least \c
+ * SSXML_INDEX_THRESHOLD children.
+ * @param name The element name.
+ * @param list Receives the children named \a name, in document order, or
+ * \b NULL when there is none.
+ * @returns \b false when the index can't be used: there are too few
+ * children, or a child found was renamed after it was indexed. The caller
+ * must then search linearly.
+ * @remarks Searches can be made from several threads at the same time. The
+ * build is serialized and the index is published only when complete.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLElement::named(const QString &name, const QList<SSXMLElement*> **list) const
+{
+    QHash<QString, QList<SSXMLElement*> > *names = m_names.loadAcquire();
 
-    if (!m_attrs.empty())
+    if (names == NULL)
+    {
+        if ((uint)m_nodes.count() < SSXML_INDEX_THRESHOLD)
+            return false;
+
+        QMutexLocker locker(__xml_namesLock());
+
+        if ((names = m_names.loadAcquire()) == NULL)
+        {
+            size_t limit = m_nodes.count();
+
+            names = new QHash<QString, QList<SSXMLElement*> >();
+            for (size_t i = 0; i < limit; ++i)
+                (*names)[m_nodes.at(i)->elementName].append(m_nodes.at(i));
+
+            m_names.storeRelease(names);
+        }
+    }
+
+    QHash<QString, QList<SSXMLElement*> >::const_iterator it = names->constFind(name);
+    if (it == names->cend())
+    {
+        *list = NULL;
+        return true;
+    }
+
+    size_t limit = it.value().count();
+    for (size_t i = 0; i < limit; ++i)
     {
-        QString fmt(" %1=\"%2\"");
+        if (it.value().at(i)->elementName != name)
+            return false;
+    }
+
+    *list = &it.value();
+    return true;
+}
+/*}}}*/
+// void SSXMLElement::addName(SSXMLElement *element);/*{{{*/
+/**
+ * Adds a child appended to the list in the index of names.
+ * @param element The child, already at the end of the list.
+ * @remarks Does nothing when there is no index. It is built by the first
+ * search only.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::addName(SSXMLElement *element)
+{
+    QHash<QString, QList<SSXMLElement*> > *names = m_names.load();
+
+    if (names != NULL)
+        (*names)[element->elementName].append(element);
+}
+/*}}}*/
+// void SSXMLElement::addNames(uint index, const QList<SSXMLElement*> &elements);/*{{{*/
+/**
+ * Adds inserted children to the index of names.
+ * @param index Position of the first child inserted.
+ * @param elements The children, already in the list, in order.
+ * @remarks Only the lists of the names inserted are changed. Children
+ * inserted at the end are appended to them. Otherwise the children before
+ * \a index are counted to find where they go.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::addNames(uint index, const QList<SSXMLElement*> &elements)
+{
+    QHash<QString, QList<SSXMLElement*> > *names = m_names.load();
+    size_t limit = elements.count();
+
+    if ((names == NULL) || (limit == 0)) return;
+
+    if ((index + limit) == (size_t)m_nodes.count())
+    {
+        for (size_t i = 0; i < limit; ++i)
+            (*names)[elements.at(i)->elementName].append(elements.at(i));
+        return;
+    }
+
+    QHash<QString, QList<SSXMLElement*> > added;
+    QHash<QString, int> before;
+    QHash<QString, int>::iterator found;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        added[elements.at(i)->elementName].append(elements.at(i));
+        before.insert(elements.at(i)->elementName, 0);
+    }
+
+    for (uint i = 0; i < index; ++i)
+    {
+        found = before.find(m_nodes.at(i)->elementName);
+        if (found != before.end()) found.value()++;
+    }
+
+    QHash<QString, QList<SSXMLElement*> >::const_iterator it;
+    for (it = added.constBegin(); it != added.constEnd(); ++it)
+    {
+        QList<SSXMLElement*> &list = (*names)[it.key()];
+        int position = before.value(it.key());
+
+        list = list.mid(0, position) + it.value() + list.mid(position);
+    }
+}
+/*}}}*/
+// void SSXMLElement::removeName(SSXMLElement *element);/*{{{*/
+/**
+ * Removes a child from the index of names.
+ * @param element The child about to be removed from the list.
+ * @remarks When the child isn't found under its name, it was renamed
+ * directly, and the index is discarded.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::removeName(SSXMLElement *element)
+{
+    QHash<QString, QList<SSXMLElement*> > *names = m_names.load();
+    if (names == NULL) return;
+
+    QHash<QString, QList<SSXMLElement*> >::iterator it = names->find(element->elementName);
+    if ((it == names->end()) || !it.value().removeOne(element))
+    {
+        dropNames();
+        return;
+    }
+    if (it.value().isEmpty()) names->erase(it);
+}
+/*}}}*/
+// void SSXMLElement::removeNames(const QSet<const SSXMLElement*> &elements);/*{{{*/
+/**
+ * Removes several children from the index of names.
+ * @param elements The children about to be removed from the list.
+ * @remarks Only the lists of their names are walked. When a child isn't
+ * found under its name, it was renamed directly, and the index is
+ * discarded.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::removeNames(const QSet<const SSXMLElement*> &elements)
+{
+    QHash<QString, QList<SSXMLElement*> > *names = m_names.load();
+    if (names == NULL) return;
+
+    QSet<QString> keys;
+    QSet<const SSXMLElement*>::const_iterator element;
+
+    for (element = elements.constBegin(); element != elements.constEnd(); ++element)
+        keys.insert((*element)->elementName);
+
+    QSet<QString>::const_iterator key;
+    size_t removed = 0;
+
+    for (key = keys.constBegin(); key != keys.constEnd(); ++key)
+    {
+        QHash<QString, QList<SSXMLElement*> >::iterator it = names->find(*key);
+        if (it == names->end()) break;
+
+        QList<SSXMLElement*> kept;
+        size_t limit = it.value().count();
+
+        kept.reserve((int)limit);
+        for (size_t i = 0; i < limit; ++i)
+        {
+            if (!elements.contains(it.value().at(i)))
+                kept.append(it.value().at(i));
+        }
+        removed += limit - kept.count();
+
+        if (kept.isEmpty())
+            names->erase(it);
+        else
+            it.value().swap(kept);
+    }
+
+    if (removed != (size_t)elements.count())
+        dropNames();
+}
+/*}}}*/
+// void SSXMLElement::clearText();/*{{{*/
+/**
+ * Clears the text of this element, reporting the change.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::clearText()
+{
+    if (m_text.isEmpty()) return;
+
+    if (!watched())
+    {
+        m_text.clear();
+        return;
+    }
+
+    QString previous;
+
+    previous.swap(m_text);
+    notify(SSXML_TEXT_CHANGED, this, -1, QString(), &previous);
+}
+/*}}}*/
+// void SSXMLElement::exchange(SSXMLElement *element);/*{{{*/
+/**
+ * Exchanges the name, attributes, text and children of two elements.
+ * @param element The other element. Must not be an ancestor nor a
+ * descendant of this element.
+ * @remarks Nothing is copied. Only the direct children are relinked, so the
+ * cost doesn't depend on the size of the subtrees. Nothing is reported and
+ * the watch state of the children is kept.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::exchange(SSXMLElement *element)
+{
+    elementName.swap(element->elementName);
+    m_attrs.swap(element->m_attrs);
+    m_text.swap(element->m_text);
+    m_nodes.swap(element->m_nodes);
+
+    QHash<QString, QList<SSXMLElement*> > *names = m_names.load();
+    m_names.store(element->m_names.load());
+    element->m_names.store(names);
+
+    size_t limit = m_nodes.count();
+    for (size_t i = 0; i < limit; ++i)
+        m_nodes.at(i)->parentElement = this;
+
+    limit = element->m_nodes.count();
+    for (size_t i = 0; i < limit; ++i)
+        element->m_nodes.at(i)->parentElement = element;
+}
+/*}}}*/
+// void SSXMLElement::dropNames();/*{{{*/
+/**
+ * Discards the index of children names.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::dropNames()
+{
+    delete m_names.fetchAndStoreRelaxed(NULL);
+}
+/*}}}*/
+// void SSXMLElement::print(QString &buffer, QTextStream *stream, uint indent, uint width, uint flags) const;/*{{{*/
+/**
+ * Appends the textual notation of this element and its descendants.
+ * @param buffer The buffer where the text is appended.
+ * @param stream When not \b NULL the contents of \a buffer are moved to
+ * this stream every time it grows past \c SSXML_PRINT_BLOCK characters.
+ * When \b NULL the whole text is kept in \a buffer.
+ * @param indent Indentation level of this element.
+ * @param width Number of spaces in each indentation level.
+ * @param flags Output options.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::print(QString &buffer, QTextStream *stream, uint indent, uint width, uint flags) const
+{
+    bool compact = ((flags & SSXML_COMPACT) != 0);
+    int  spaces  = (compact ? 0 : (int)(indent * width));
+    uint escape  = ((flags & SSXML_NORMALIZED) ? SSXML_ESCAPE_SPACES : 0);
+
+    if (spaces > 0) buffer.append(QString(spaces, ' '));
+
+    buffer.append('<').append(elementName);
+
+    if ((flags & SSXML_SORTED) && (m_attrs.count() > 1))
+    {
+        QVarLengthArray<QHash<QString, QString>::const_iterator, 16> sorted;
         QHash<QString, QString>::const_iterator it = m_attrs.cbegin();
 
+        while (it != m_attrs.cend())
+            sorted.append(it++);
+
+        std::sort(sorted.begin(), sorted.end(), __xml_lessThan);
+
+        size_t limit = sorted.count();
+        for (size_t i = 0; i < limit; ++i)
+        {
+            buffer.append(' ').append(sorted[i].key()).append(QLatin1String("=\""));
+            __xml_escape(buffer, sorted[i].value(), escape | SSXML_ESCAPE_QUOTES);
+            buffer.append('"');
+        }
+    }
+    else
+    {
+        QHash<QString, QString>::const_iterator it = m_attrs.cbegin();
         while (it != m_attrs.cend())
         {
-            xml.append(fmt.arg(it.key(), it.value()));
+            buffer.append(' ').append(it.key()).append(QLatin1String("=\""));
+            __xml_escape(buffer, it.value(), escape | SSXML_ESCAPE_QUOTES);
+            buffer.append('"');
             ++it;
         }
     }
 
-    xml.append((m_nodes.empty() ? "/>" : ">"));
-
-    device->write(xml.toUtf8());
-    xml.clear();
+    QString text = ((flags & SSXML_NORMALIZED) ? m_text.simplified() : m_text);
 
-    if (!m_nodes.empty())
+    if (!m_nodes.isEmpty())
     {
         size_t limit = m_nodes.count();
-        SSXMLElement *node;
+
+        buffer.append('>');
+        if (!compact) buffer.append('\n');
 
         for (size_t i = 0; i < limit; ++i)
         {
-            node = m_nodes.at(i);
-            node->write(device);
+            m_nodes.at(i)->print(buffer, stream, indent + 1, width, flags);
+
+            if (stream && (buffer.length() >= SSXML_PRINT_BLOCK))
+            {
+                *stream << buffer;
+                buffer.resize(0);           /* Keeps the allocated block. */
+            }
         }
-        device->write("</", 2);
-        device->write(elementName.toUtf8());
-        device->write(">", 1);
+
+        if (spaces > 0) buffer.append(QString(spaces, ' '));
+        buffer.append(QLatin1String("</")).append(elementName).append('>');
     }
-    return true;
+    else if (!text.isEmpty() || (flags & SSXML_NORMALIZED))
+    {
+        buffer.append('>');
+        __xml_escape(buffer, text, 0);
+        buffer.append(QLatin1String("</")).append(elementName).append('>');
+    }
+    else
+        buffer.append(QLatin1String("/>"));
+
+    if (!compact) buffer.append('\n');
 }
 /*}}}*/
-///@} Overridable Operations
+// static void SSXMLElement::escape(QString &buffer, const QString &value, bool attribute);/*{{{*/
+/**
+ * Appends a text replacing the characters that cannot be written literally.
+ * @param buffer The buffer where the text is appended.
+ * @param value The text to escape.
+ * @param attribute \b true when \a value is the value of an attribute.
+ * Double quotes are also escaped in this case.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLElement::escape(QString &buffer, const QString &value, bool attribute)
+{
+    __xml_escape(buffer, value, (attribute ? SSXML_ESCAPE_QUOTES : 0));
+}
+/*}}}*/
+///@} Implementation
+
+// static size_t __xml_escapedLength(const QString &value, uint escape);/*{{{*/
+static size_t __xml_escapedLength(const QString &value, uint escape)
+{
+    const QChar *data = value.constData();
+    size_t limit  = value.length();
+    size_t length = limit;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        switch (data[i].unicode())
+        {
+        case '&': length += 4; break;       /* &amp;  */
+        case '<':
+        case '>': length += 3; break;       /* &lt; &gt; */
+        case '"':
+            if (escape & SSXML_ESCAPE_QUOTES) length += 5;  /* &quot; */
+            break;
+        case '\t':
+            if (escape & SSXML_ESCAPE_SPACES) length += 3;  /* &#9;  */
+            break;
+        case '\n':
+        case '\r':
+            if (escape & SSXML_ESCAPE_SPACES) length += 4;  /* &#10; &#13; */
+            break;
+        }
+    }
+    return length;
+}
+/*}}}*/
+// static void __xml_escape(QString &buffer, const QString &value, uint escape);/*{{{*/
+static void __xml_escape(QString &buffer, const QString &value, uint escape)
+{
+    const QChar *data = value.constData();
+    int limit = value.length();
+    int start = 0;
+    const char *entity;
 
+    for (int i = 0; i < limit; ++i)
+    {
+        switch (data[i].unicode())
+        {
+        case '&':  entity = "&amp;";  break;
+        case '<':  entity = "&lt;";   break;
+        case '>':  entity = "&gt;";   break;
+        case '"':  entity = ((escape & SSXML_ESCAPE_QUOTES) ? "&quot;" : NULL); break;
+        case '\t': entity = ((escape & SSXML_ESCAPE_SPACES) ? "&#9;"   : NULL); break;
+        case '\n': entity = ((escape & SSXML_ESCAPE_SPACES) ? "&#10;"  : NULL); break;
+        case '\r': entity = ((escape & SSXML_ESCAPE_SPACES) ? "&#13;"  : NULL); break;
+        default:   entity = NULL;     break;
+        }
+
+        if (!entity) continue;
+
+        buffer.append(data + start, i - start);
+        buffer.append(QLatin1String(entity));
+        start = i + 1;
+    }
+
+    if (start == 0)
+        buffer.append(value);           /* Nothing to escape. */
+    else
+        buffer.append(data + start, limit - start);
+}
+/*}}}*/
+// static bool __xml_lessThan(const QHash<QString, QString>::const_iterator &a, const QHash<QString, QString>::const_iterator &b);/*{{{*/
+static bool __xml_lessThan(const QHash<QString, QString>::const_iterator &a, const QHash<QString, QString>::const_iterator &b)
+{
+    return (a.key() < b.key());
+}
+/*}}}*/
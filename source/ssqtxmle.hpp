@@ -17,9 +17,229 @@
 #define __SSQTXMLE_HPP_DEFINED__
 
 #include <QString>
+#include <QByteArray>
 #include <QIODevice>
 #include <QList>
 #include <QHash>
+#include <QSet>
+#include <QAtomicPointer>
+#include <QTextStream>
+
+/**
+ * \ingroup ssqt_xml
+ * Output options of SSXMLElement::toString() and SSXMLElement::print().
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_COMPACT       0x0001  /**< No indentation nor line breaks.    */
+#define SSXML_SORTED        0x0002  /**< Attributes sorted by name.         */
+// #define SSXML_NORMALIZED    0x0004/*{{{*/
+/**
+ * Normalized content.
+ * Leading and trailing white space of texts is removed and white space
+ * sequences are replaced by a single space. Tabs, line feeds and carriage
+ * returns in attribute values are written as character references. Empty
+ * elements are written with start and end tags.
+ * @since 1.1
+ **/
+#define SSXML_NORMALIZED    0x0004
+/*}}}*/
+// #define SSXML_CANONICAL     (SSXML_COMPACT | SSXML_SORTED | SSXML_NORMALIZED)/*{{{*/
+/**
+ * Canonical form.
+ * The same element tree always produces the same text, whatever the order
+ * the attributes were set or the Qt version in use. Suitable as input for
+ * hash functions and byte level comparisons.
+ * @since 1.1
+ **/
+#define SSXML_CANONICAL     (SSXML_COMPACT | SSXML_SORTED | SSXML_NORMALIZED)
+/*}}}*/
+#define SSXML_INDENT_WIDTH  2       /**< Default indentation width.         */
+///@}
+
+/**
+ * \ingroup ssqt_xml
+ * Number of characters accumulated before they are passed to a \c
+ * QTextStream by SSXMLElement::print() and by SSXMLWriter.
+ * @since 1.1
+ **/
+#define SSXML_PRINT_BLOCK   16384
+
+/**
+ * \ingroup ssqt_xml
+ * Number of children an element must have before SSXMLElement::firstChild(),
+ * SSXMLElement::children() and SSXMLElement::countChildren() build an index
+ * of their names. Elements with less children are searched linearly.
+ * @since 1.1
+ **/
+#define SSXML_INDEX_THRESHOLD   32
+
+/**
+ * \ingroup ssqt_xml
+ * Changes reported by SSXMLElement::changed().
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_ATTRIBUTE_CHANGED 1   /**< Attribute added or changed.        */
+#define SSXML_ATTRIBUTE_REMOVED 2   /**< Attribute removed.                 */
+#define SSXML_CHILD_ADDED       3   /**< Child attached, with its subtree.  */
+#define SSXML_CHILD_REMOVED     4   /**< Child about to be detached.        */
+#define SSXML_TEXT_CHANGED      5   /**< Text changed or cleared.           */
+///@}
+
+/**
+ * @ingroup ssqt_xml
+ * Memory footprint of an element tree.
+ * Filled by SSXMLElement::statistics() or kept by \c SSXMLDocument while the
+ * document is loaded. All byte counts are estimates of the heap memory used
+ * by the Qt containers and strings on the current platform. Implicitly shared
+ * strings are counted once for each element that holds them.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+struct SSXMLStatistics
+{
+    size_t elements;        /**< Number of elements.                        */
+    size_t attributes;      /**< Number of attributes.                      */
+    size_t nameBytes;       /**< Bytes in elements and attributes names.    */
+    size_t valueBytes;      /**< Bytes in attributes values.                */
+    size_t textBytes;       /**< Bytes in elements texts.                   */
+    size_t overheadBytes;   /**< Bytes in objects and containers.           */
+    size_t maxDepth;        /**< Deepest level. The root is at level 1.     */
+
+    SSXMLStatistics();
+
+    // size_t totalBytes() const;/*{{{*/
+    /**
+     * Total memory used.
+     * @returns The sum of names, values, texts and overhead bytes.
+     * @since 1.1
+     **/
+    size_t totalBytes() const;
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Resets all counters to zero.
+     * @since 1.1
+     **/
+    void clear();
+    /*}}}*/
+    // static size_t stringBytes(int length);/*{{{*/
+    /**
+     * Heap memory used by a \c QString.
+     * @param length Number of characters in the string.
+     * @returns The size of the string data block. Empty strings share
+     * a static block and use no memory.
+     * @since 1.1
+     **/
+    static size_t stringBytes(int length);
+    /*}}}*/
+    // static size_t listBytes(int count);/*{{{*/
+    /**
+     * Heap memory used by a \c QList of pointers.
+     * @param count Number of items in the list.
+     * @returns The size of the list data block.
+     * @since 1.1
+     **/
+    static size_t listBytes(int count);
+    /*}}}*/
+    // static size_t hashBytes(int count, int buckets);/*{{{*/
+    /**
+     * Heap memory used by a \c QHash of strings, without the strings data.
+     * @param count Number of items in the hash.
+     * @param buckets Number of buckets in the hash table.
+     * @returns The size of the hash header, table and nodes.
+     * @since 1.1
+     **/
+    static size_t hashBytes(int count, int buckets);
+    /*}}}*/
+};
+
+/**
+ * @ingroup ssqt_xml
+ * A precomputed attribute or element name.
+ * Passing a string literal where a \c QString is expected builds a new
+ * string, decoding the literal, in every call. A key is built once, usually
+ * as a static object, and converts to the string it holds with no cost:
+ * ~~~~~~~~~~~~~~{.cpp}
+ * static const SSXMLKey iconKey("icon");
+ *
+ * const QString *icon = element->find(iconKey);
+ * if (icon != NULL) setIcon(QIcon(*icon));
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLKey
+{
+public:
+    // explicit SSXMLKey(const char *name);/*{{{*/
+    /**
+     * Builds a key from a Latin-1 name.
+     * @param name The name. Usually a string literal.
+     * @since 1.1
+     **/
+    explicit SSXMLKey(const char *name);
+    /*}}}*/
+    // explicit SSXMLKey(const QString &name);/*{{{*/
+    /**
+     * Builds a key from a string.
+     * @param name The name.
+     * @since 1.1
+     **/
+    explicit SSXMLKey(const QString &name);
+    /*}}}*/
+
+public:         // Attributes
+    // const QString& name() const;/*{{{*/
+    /**
+     * The name of this key.
+     * @since 1.1
+     **/
+    const QString& name() const;
+    /*}}}*/
+
+public:         // Overloaded Operators
+    // operator const QString&() const;/*{{{*/
+    /**
+     * Converts this key to its name.
+     * Lets keys be passed to every function that takes a name.
+     * @since 1.1
+     **/
+    operator const QString&() const;
+    /*}}}*/
+    // bool operator ==(const SSXMLKey &other) const;/*{{{*/
+    /**
+     * Compares the names of two keys.
+     * @since 1.1
+     **/
+    bool operator ==(const SSXMLKey &other) const;
+    /*}}}*/
+
+protected:      // Data Members
+    QString m_name;                     /**< The name.                      */
+};
+
+/**
+ * @internal
+ * Keys of the elements and attributes of menus and toolbars.
+ * Built from the \c SS_MENU_NODE_*, \c SS_MENU_ATTR_* and \c SS_XML_*
+ * names.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+struct SSXMLKeys
+{
+    static const SSXMLKey menuItem;     /**< \c SS_MENU_NODE_ITEM.          */
+    static const SSXMLKey menuSeparator;/**< \c SS_MENU_NODE_SEPARATOR.     */
+    static const SSXMLKey menuPopup;    /**< \c SS_MENU_NODE_POPUP.         */
+    static const SSXMLKey menuMenu;     /**< \c SS_MENU_NODE_MENU.          */
+    static const SSXMLKey attrId;       /**< \c SS_MENU_ATTR_ID.            */
+    static const SSXMLKey attrName;     /**< \c SS_MENU_ATTR_NAME.          */
+    static const SSXMLKey attrText;     /**< \c SS_MENU_ATTR_TEXT.          */
+    static const SSXMLKey attrDesc;     /**< \c SS_MENU_ATTR_DESC.          */
+    static const SSXMLKey attrKeys;     /**< \c SS_MENU_ATTR_KEYS.          */
+    static const SSXMLKey attrIcon;     /**< \c SS_MENU_ATTR_ICON.          */
+    static const SSXMLKey attrChecked;  /**< \c SS_MENU_ATTR_CHECKED.       */
+    static const SSXMLKey attrDefault;  /**< \c SS_MENU_ATTR_DEFAULT.       */
+    static const SSXMLKey attrRef;      /**< \c SS_MENU_ATTR_REF.           */
+    static const SSXMLKey nodeToolbar;  /**< \c SS_XML_NODE_TOOLBAR.        */
+    static const SSXMLKey nodeButton;   /**< \c SS_XML_NODE_BUTTON.         */
+    static const SSXMLKey attrEnabled;  /**< \c SS_XML_ATTR_ENABLED.        */
+};
 
 /**
  * @ingroup ssqt_xml
@@ -105,8 +325,34 @@ public:         // Attributes
      **/
     bool    text(const QString &elementText);
     /*}}}*/
+    // const QHash<QString, QString>& attributes() const;/*{{{*/
+    /**
+     * Gives read only access to the list of attributes of this element.
+     * @return A reference to the internal attribute's map. Keys are the
+     * attributes names. Values are the attributes values.
+     * @remarks Useful to iterate over all attributes without looking up each
+     * name. The reference is valid while this element is not changed.
+     * @since 1.1
+     **/
+    const QHash<QString, QString>& attributes() const;
+    /*}}}*/
 
 public:         // Attributes Operations
+    // const QString* find(const QString &attrName) const;/*{{{*/
+    /**
+     * Finds an attribute of this element.
+     * @param attrName Name of the attribute. A SSXMLKey can be used to not
+     * build the name in every call.
+     * @return Pointer to the attribute's value or \b NULL when the attribute
+     * doesn't exist.
+     * @remarks Checks whether the attribute exists and gets its value with a
+     * single lookup, where #has() followed by #attribute() needs two. The
+     * pointer is valid while the attributes of this element are not
+     * changed.
+     * @since 1.1
+     **/
+    const QString* find(const QString &attrName) const;
+    /*}}}*/
     // QString attribute(const QString &attrName) const;/*{{{*/
     /**
      * Gets the value of an attribute of this element.
@@ -151,6 +397,30 @@ public:         // Attributes Operations
      **/
     bool boolValueOf(const QString &attrName, bool defaultValue = false) const;
     /*}}}*/
+    // static int intValue(const QString &value, int defaultValue = 0);/*{{{*/
+    /**
+     * Converts a value to \b int.
+     * Applies the conversion of #intValueOf() to a value already found, as
+     * with #find().
+     * @param value The value.
+     * @param defaultValue Result when \a value cannot be converted.
+     * @returns The converted value.
+     * @since 1.1
+     **/
+    static int intValue(const QString &value, int defaultValue = 0);
+    /*}}}*/
+    // static bool boolValue(const QString &value, bool defaultValue = false);/*{{{*/
+    /**
+     * Converts a value to \b boolean.
+     * Applies the conversion of #boolValueOf() to a value already found, as
+     * with #find().
+     * @param value The value.
+     * @param defaultValue Result when \a value cannot be converted.
+     * @returns The converted value.
+     * @since 1.1
+     **/
+    static bool boolValue(const QString &value, bool defaultValue = false);
+    /*}}}*/
     // SSXMLElement& set(const QString &attrName, const QString &attrValue);/*{{{*/
     /**
      * Adds ore replaces an attribute in this element.
@@ -212,6 +482,17 @@ public:         // Attributes Operations
      **/
     void removeAllAttributes();
     /*}}}*/
+    // void reserveAttributes(uint count);/*{{{*/
+    /**
+     * Reserves space for attributes.
+     * @param count Total number of attributes this element is expected to
+     * have.
+     * @remarks Setting \a count attributes after this call will not rehash
+     * the table of attributes.
+     * @since 1.1
+     **/
+    void reserveAttributes(uint count);
+    /*}}}*/
 
 public:         // Child Element Operations
     // int indexOf(const SSXMLElement *element) const;/*{{{*/
@@ -255,6 +536,42 @@ public:         // Child Element Operations
      **/
     SSXMLElement* lastElement() const;
     /*}}}*/
+    // SSXMLElement* firstChild(const QString &name) const;/*{{{*/
+    /**
+     * Finds the first child element with a name.
+     * @param name The element name.
+     * @returns The first child named \a name or \b NULL.
+     * @remarks The first search in an element with \c SSXML_INDEX_THRESHOLD
+     * children or more builds an index of their names. After that the index
+     * is updated when children are added or removed. Loading or building a
+     * tree never builds it. Searches can run in several threads at the same
+     * time: the build is serialized. When a child found in the index has
+     * been renamed through its #elementName, the children are searched
+     * linearly.
+     * @since 1.1
+     **/
+    SSXMLElement* firstChild(const QString &name) const;
+    /*}}}*/
+    // QList<SSXMLElement*> children(const QString &name) const;/*{{{*/
+    /**
+     * Finds all child elements with a name.
+     * @param name The element name.
+     * @returns The list of children named \a name, in document order.
+     * @remarks See #firstChild() about the index of names.
+     * @since 1.1
+     **/
+    QList<SSXMLElement*> children(const QString &name) const;
+    /*}}}*/
+    // size_t countChildren(const QString &name) const;/*{{{*/
+    /**
+     * Counts the child elements with a name.
+     * @param name The element name.
+     * @returns The number of children named \a name.
+     * @remarks See #firstChild() about the index of names.
+     * @since 1.1
+     **/
+    size_t countChildren(const QString &name) const;
+    /*}}}*/
     // SSXMLElement& append(const SSXMLElement &element);/*{{{*/
     /**
      * Appends an element as child of this element.
@@ -277,6 +594,31 @@ public:         // Child Element Operations
      **/
     SSXMLElement& append(SSXMLElement *element);
     /*}}}*/
+    // SSXMLElement& append(const QList<SSXMLElement*> &elements);/*{{{*/
+    /**
+     * Appends several elements as children of this element.
+     * @param elements List of elements to append, in order. \b NULL
+     * pointers are ignored.
+     * @returns The function returns \b this.
+     * @remarks This element takes ownership of all elements in the list. The
+     * list of children grows once, not once per element. Like in
+     * #append(SSXMLElement*) the elements must not be children of another
+     * element.
+     * @since 1.1
+     **/
+    SSXMLElement& append(const QList<SSXMLElement*> &elements);
+    /*}}}*/
+    // void reserveChildren(uint count);/*{{{*/
+    /**
+     * Reserves space for children elements.
+     * @param count Total number of children this element is expected to
+     * have.
+     * @remarks Avoids reallocations of the list of children when a large
+     * number of elements is appended one at a time.
+     * @since 1.1
+     **/
+    void reserveChildren(uint count);
+    /*}}}*/
     // bool remove(const SSXMLElement *element);/*{{{*/
     /**
      * Removes a child element from this element.
@@ -291,6 +633,63 @@ public:         // Child Element Operations
      **/
     bool remove(const SSXMLElement *element);
     /*}}}*/
+    // SSXMLElement* take(uint index);/*{{{*/
+    /**
+     * Removes a child element and gives it to the caller.
+     * @param index Zero based index of the child element to take.
+     * @returns The removed element or \b NULL when \a index is invalid.
+     * @remarks The element and its whole subtree are not copied nor deleted.
+     * The caller owns the returned element and must delete it, or pass it to
+     * another element with #append(SSXMLElement*) or #insert(uint,
+     * SSXMLElement*). Its #parentElement member is set to \b NULL.
+     * @since 1.1
+     **/
+    SSXMLElement* take(uint index);
+    /*}}}*/
+    // SSXMLElement& insert(uint index, const SSXMLElement &element);/*{{{*/
+    /**
+     * Inserts a copy of an element as child of this element.
+     * @param index Zero based position of the new child. Values past the
+     * last child append the element.
+     * @param element Reference to the element to copy.
+     * @returns The function returns \b this.
+     * @since 1.1
+     **/
+    SSXMLElement& insert(uint index, const SSXMLElement &element);
+    /*}}}*/
+    // SSXMLElement& insert(uint index, SSXMLElement *element);/*{{{*/
+    /**
+     * Inserts an element as child of this element.
+     * @param index Zero based position of the new child. Values past the
+     * last child append the element.
+     * @param element Pointer to the element to insert.
+     * @returns The function returns \b this.
+     * @remarks This element takes ownership of \a element. It must not be
+     * a child of another element. Use #take() or #splice() to move elements
+     * between parents. Nothing is copied.
+     * @since 1.1
+     **/
+    SSXMLElement& insert(uint index, SSXMLElement *element);
+    /*}}}*/
+    // size_t splice(uint index, SSXMLElement *source, uint first = 0, uint count = ~0U);/*{{{*/
+    /**
+     * Moves children of another element to this element.
+     * @param index Zero based position, in this element, where the moved
+     * elements will be placed. Values past the last child append them.
+     * @param source The element having the children to move. Can be an
+     * element of another document.
+     * @param first Index of the first child of \a source to move.
+     * @param count Number of children to move. The default moves all
+     * children from \a first to the end.
+     * @returns The number of elements moved. Zero when \a source is \b
+     * NULL, is this element, or when the range includes an ancestor of this
+     * element.
+     * @remarks The moved subtrees are relinked, not copied. Their ownership
+     * is transferred to this element.
+     * @since 1.1
+     **/
+    size_t splice(uint index, SSXMLElement *source, uint first = 0, uint count = ~0U);
+    /*}}}*/
     // bool remove(uint index);/*{{{*/
     /**
      * Removes an element at the specified index.
@@ -302,6 +701,19 @@ public:         // Child Element Operations
      **/
     bool remove(uint index);
     /*}}}*/
+    // size_t removeElements(const QList<SSXMLElement*> &elements);/*{{{*/
+    /**
+     * Removes several children of this element in a single pass.
+     * @param elements The children to remove, in any order. Elements that
+     * are not children of this element are ignored.
+     * @returns The number of children removed.
+     * @remarks The removed elements are \e deleted. Runs in linear time on
+     * the number of children, while removing them one by one with
+     * #remove(uint) is quadratic.
+     * @since 1.1
+     **/
+    size_t removeElements(const QList<SSXMLElement*> &elements);
+    /*}}}*/
     // void removeAllElements();/*{{{*/
     /**
      * Remove all children elements from this element.
@@ -317,7 +729,8 @@ public:         // Overridable Operations
      * @param element Other element to check for equality.
      * @returns \b true when both elements are equals. Otherwise \b false.
      * @remarks Two elements are equals if they have the same name, the same
-     * list of attributes with values and all its children are also equals.
+     * list of attributes with values, the same text and all its children are
+     * also equals.
      * @note Depending uppon the number of children elements this function can
      * be very expensive.
      * @since 1.1
@@ -327,7 +740,7 @@ public:         // Overridable Operations
     // virtual void assign(const SSXMLElement *element);/*{{{*/
     /**
      * Copy operation.
-     * @param element Element to copy all its attributes and children.
+     * @param element Element to copy all its attributes, text and children.
      * @remarks This operation can be expensive since all attributes and
      * children elements including its attributes and children elements will
      * be duplicated.
@@ -354,11 +767,69 @@ public:         // Overridable Operations
      * @remarks The operation will convert this element and all its children
      * into a well-formed XML element. The difference of this version to
      * #toString() is that the string returned will be indented and a line
-     * break will be added at each elements end.
+     * break will be added at each elements end. The same as calling
+     * <tt>toString(indent, SSXML_INDENT_WIDTH, 0)</tt>.
      * @since 1.1
      **/
     virtual QString toString(uint indent) const;
     /*}}}*/
+    // QString toString(uint indent, uint width, uint flags) const;/*{{{*/
+    /**
+     * Converts this element to its textual notation.
+     * @param indent Indentation level of this element.
+     * @param width Number of spaces in each indentation level.
+     * @param flags Output options. Can be \b 0 or a combination of \c
+     * SSXML_COMPACT, \c SSXML_SORTED and \c SSXML_NORMALIZED. When \c
+     * SSXML_COMPACT is used the indentation is ignored and no line breaks
+     * are added. \c SSXML_CANONICAL selects the canonical form.
+     * @returns A \c QString object with the textual (XML) notation.
+     * Attribute values and texts are escaped.
+     * @remarks The length of the result is computed first, so the whole
+     * tree is written in a single buffer allocated only once.
+     * @sa printLength()
+     * @since 1.1
+     **/
+    QString toString(uint indent, uint width, uint flags) const;
+    /*}}}*/
+    // bool print(QTextStream &stream, uint indent = 0, uint width = SSXML_INDENT_WIDTH, uint flags = 0) const;/*{{{*/
+    /**
+     * Writes the textual notation of this element to a text stream.
+     * @param stream The target stream.
+     * @param indent Indentation level of this element.
+     * @param width Number of spaces in each indentation level.
+     * @param flags Output options. The same of #toString(uint,uint,uint).
+     * @return \b true on success. \b false when the stream reports an
+     * error.
+     * @remarks The output is the same of #toString(uint,uint,uint). The text
+     * is passed to \a stream in blocks of limited size, so the memory used
+     * doesn't depend on the size of the tree.
+     * @since 1.1
+     **/
+    bool print(QTextStream &stream, uint indent = 0, uint width = SSXML_INDENT_WIDTH, uint flags = 0) const;
+    /*}}}*/
+    // size_t printLength(uint indent = 0, uint width = SSXML_INDENT_WIDTH, uint flags = 0) const;/*{{{*/
+    /**
+     * Computes the length of the textual notation of this element.
+     * @param indent Indentation level of this element.
+     * @param width Number of spaces in each indentation level.
+     * @param flags Output options. The same of #toString(uint,uint,uint).
+     * @returns The number of characters that #toString(uint,uint,uint)
+     * returns for the same arguments.
+     * @since 1.1
+     **/
+    size_t printLength(uint indent = 0, uint width = SSXML_INDENT_WIDTH, uint flags = 0) const;
+    /*}}}*/
+    // QByteArray canonical() const;/*{{{*/
+    /**
+     * Canonical form of this element.
+     * @returns The UTF-8 encoded text of this element in canonical form
+     * (\c SSXML_CANONICAL). Equal trees always produce the same bytes.
+     * @remarks The result is meant to be used as input of hash functions,
+     * for content addressed caching or deduplication.
+     * @since 1.1
+     **/
+    QByteArray canonical() const;
+    /*}}}*/
     // virtual bool write(QIODevice *device);/*{{{*/
     /**
      * Writes this element to a QIODevice object.
@@ -366,11 +837,37 @@ public:         // Overridable Operations
      * NULL.
      * @return \b true when the device is written successful. \b false
      * otherwise.
+     * @remarks The element is written in UTF-8, without indentation, with
+     * attributes sorted by name. So the output doesn't change between runs.
      * @since 1.1
      **/
     virtual bool write(QIODevice *device);
     /*}}}*/
 
+public:         // Statistics
+    // size_t memoryUsage() const;/*{{{*/
+    /**
+     * Estimates the memory used by this element.
+     * @returns The number of bytes used by this element and all its
+     * descendants. Includes names, values, texts and the overhead of the
+     * objects and containers.
+     * @sa statistics()
+     * @since 1.1
+     **/
+    size_t memoryUsage() const;
+    /*}}}*/
+    // void statistics(SSXMLStatistics *stats) const;/*{{{*/
+    /**
+     * Collects statistics of this element and its descendants.
+     * @param stats Object that will receive the statistics. Its counters
+     * are accumulated, not reset, so the same object can be passed for
+     * several trees.
+     * @remarks The whole tree is visited once.
+     * @since 1.1
+     **/
+    void statistics(SSXMLStatistics *stats) const;
+    /*}}}*/
+
 public:         // Overloaded Operators
     // bool operator ==(const SSXMLElement &other) const;/*{{{*/
     /**
@@ -378,7 +875,8 @@ public:         // Overloaded Operators
      * @param other Other element to check for equality.
      * @returns \b true when both elements are equals. Otherwise \b false.
      * @remarks Two elements are equals if they have the same name, the same
-     * list of attributes with values and all its children are also equals.
+     * list of attributes with values, the same text and all its children are
+     * also equals.
      * @note Depending uppon the number of children elements this function can
      * be very expensive.
      * @since 1.1
@@ -414,13 +912,163 @@ public:         // Data Members
     QString elementName;                /**< Name of this element.          */
     SSXMLElement *parentElement;        /**< Parent element.                */
 
+protected:
+    void statistics(SSXMLStatistics *stats, size_t depth) const;
+    void print(QString &buffer, QTextStream *stream, uint indent, uint width, uint flags) const;
+
+    static void escape(QString &buffer, const QString &value, bool attribute);
+
+protected:      // Change Notification
+    // virtual void changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);/*{{{*/
+    /**
+     * Called on the root of a tree when one of its elements changes.
+     * @param change One of \c SSXML_ATTRIBUTE_CHANGED, \c
+     * SSXML_ATTRIBUTE_REMOVED, \c SSXML_CHILD_ADDED, \c SSXML_CHILD_REMOVED
+     * or \c SSXML_TEXT_CHANGED.
+     * @param element The element whose attribute or text changed. For child
+     * changes, the child added or about to be removed. It is still in the
+     * tree in both cases.
+     * @param index For child changes, the position of \a element in the
+     * list of children of its parent. \b -1 for other changes.
+     * @param name Name of the attribute. Empty for other changes.
+     * @param previous Previous value of the attribute or previous text. \b
+     * NULL when the attribute was added and for child changes.
+     * @remarks Changes are reported only while the tree is watched, see
+     * #watch(). The default implementation does nothing.
+     * Elements deleted without being removed from their parents, and
+     * changes made directly in #elementName, are not reported.
+     * @since 1.1
+     **/
+    virtual void changed(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);
+    /*}}}*/
+    // virtual void released(SSXMLElement *element, bool owned);/*{{{*/
+    /**
+     * Called on the root of a tree when a removed child left the tree.
+     * @param element The child, after \c SSXML_CHILD_REMOVED was reported
+     * for it. Its #parentElement is already \b NULL.
+     * @param owned \b true when \a element is deleted after this call. Its
+     * content can then be taken instead of copied. \b false when the
+     * caller of #take() or #splice() keeps it.
+     * @remarks Called only while the tree is watched. The default
+     * implementation does nothing.
+     * @since 1.1
+     **/
+    virtual void released(SSXMLElement *element, bool owned);
+    /*}}}*/
+    // void watch(bool enable);/*{{{*/
+    /**
+     * Enables or disables change notifications in the tree of this element.
+     * @param enable \b true to enable, \b false to release a previous
+     * call with \b true. Calls are counted. Notifications are sent while
+     * there are more calls enabling than disabling them.
+     * @remarks Must be called on the root of the tree. Elements added to a
+     * watched tree are watched too, and elements taken from it are not
+     * anymore. Changes in other trees cost no more than a test of a flag.
+     * @since 1.1
+     **/
+    void watch(bool enable);
+    /*}}}*/
+    bool watched() const;
+    void watchTree(bool watched);
+    void notify(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);
+    void release(SSXMLElement *element, bool owned);
+
+protected:      // Implementation
+    bool named(const QString &name, const QList<SSXMLElement*> **list) const;
+    void addName(SSXMLElement *element);
+    void addNames(uint index, const QList<SSXMLElement*> &elements);
+    void removeName(SSXMLElement *element);
+    void removeNames(const QSet<const SSXMLElement*> &elements);
+    void dropNames();
+    void exchange(SSXMLElement *element);
+    void clearText();
+
 protected:
     QList<SSXMLElement*> m_nodes;       /**< List of children elements.     */
     QHash<QString, QString> m_attrs;    /**< Attributes of this element.    */
     QString m_text;                     /**< Text of this element.          */
+    mutable QAtomicPointer<QHash<QString, QList<SSXMLElement*> > > m_names; /**< Children by name. */
+    uint m_watchers;                    /**< Calls enabling notifications.  */
+    bool m_watched;                     /**< The tree is being watched.     */
+
+    friend class SSXMLRecordReader;
+    friend class SSXMLWriter;
+    friend class SSXMLQuery;
+    friend class SSXMLDocument;
+    friend class SSXMLJournal;
 };
 /* Inlined Functions {{{ */
 /* ------------------------------------------------------------------------ */
+/*! \name SSXMLStatistics *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLStatistics::SSXMLStatistics();/*{{{*/
+/**
+ * Default constructor.
+ * All counters start at zero.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLStatistics::SSXMLStatistics() {
+    clear();
+}
+/*}}}*/
+// inline size_t SSXMLStatistics::totalBytes() const;/*{{{*/
+inline size_t SSXMLStatistics::totalBytes() const {
+    return (nameBytes + valueBytes + textBytes + overheadBytes);
+}
+/*}}}*/
+// inline void SSXMLStatistics::clear();/*{{{*/
+inline void SSXMLStatistics::clear() {
+    elements = attributes = 0;
+    nameBytes = valueBytes = textBytes = overheadBytes = 0;
+    maxDepth = 0;
+}
+/*}}}*/
+// inline size_t SSXMLStatistics::stringBytes(int length);/*{{{*/
+inline size_t SSXMLStatistics::stringBytes(int length) {
+    if (length <= 0) return 0;
+    return (sizeof(QArrayData) + (size_t)(length + 1) * sizeof(QChar));
+}
+/*}}}*/
+// inline size_t SSXMLStatistics::listBytes(int count);/*{{{*/
+inline size_t SSXMLStatistics::listBytes(int count) {
+    if (count <= 0) return 0;
+    return (sizeof(QListData::Data) + (size_t)count * sizeof(void*));
+}
+/*}}}*/
+// inline size_t SSXMLStatistics::hashBytes(int count, int buckets);/*{{{*/
+inline size_t SSXMLStatistics::hashBytes(int count, int buckets) {
+    if (count <= 0) return 0;
+    return (sizeof(QHashData) + (size_t)buckets * sizeof(void*) +
+            (size_t)count * sizeof(QHashNode<QString, QString>));
+}
+/*}}}*/
+///@} SSXMLStatistics /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLKey *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLKey::SSXMLKey(const char *name);/*{{{*/
+inline SSXMLKey::SSXMLKey(const char *name) : m_name(QLatin1String(name)) { }
+/*}}}*/
+// inline SSXMLKey::SSXMLKey(const QString &name);/*{{{*/
+inline SSXMLKey::SSXMLKey(const QString &name) : m_name(name) { }
+/*}}}*/
+// inline const QString& SSXMLKey::name() const;/*{{{*/
+inline const QString& SSXMLKey::name() const {
+    return m_name;
+}
+/*}}}*/
+// inline SSXMLKey::operator const QString&() const;/*{{{*/
+inline SSXMLKey::operator const QString&() const {
+    return m_name;
+}
+/*}}}*/
+// inline bool SSXMLKey::operator ==(const SSXMLKey &other) const;/*{{{*/
+inline bool SSXMLKey::operator ==(const SSXMLKey &other) const {
+    return (m_name == other.m_name);
+}
+/*}}}*/
+///@} SSXMLKey /*}}}*/
+/* ------------------------------------------------------------------------ */
 /*! \name Constructors & Destructor *//*{{{*/ //@{
 /* ------------------------------------------------------------------------ */
 // inline SSXMLElement::SSXMLElement(SSXMLElement *parent);/*{{{*/
@@ -432,7 +1080,7 @@ protected:
  * is updated.
  * @since 1.1
  *//* --------------------------------------------------------------------- */
-inline SSXMLElement::SSXMLElement(SSXMLElement *parent) : parentElement(parent) { }
+inline SSXMLElement::SSXMLElement(SSXMLElement *parent) : parentElement(parent), m_names(NULL), m_watchers(0), m_watched(false) { }
 /*}}}*/
 // inline SSXMLElement::SSXMLElement(const SSXMLElement &other, SSXMLElement *parent);/*{{{*/
 /**
@@ -447,8 +1095,9 @@ inline SSXMLElement::SSXMLElement(SSXMLElement *parent) : parentElement(parent)
  * @since 1.1
  *//* --------------------------------------------------------------------- */
 inline SSXMLElement::SSXMLElement(const SSXMLElement &other, SSXMLElement *parent) : 
-    parentElement(parent) {
-    assign(&other);
+    parentElement(NULL), m_names(NULL), m_watchers(0), m_watched(false) {
+    assign(&other);             /* Not reported to the parent's tree. */
+    parentElement = parent;
 }
 /*}}}*/
 // inline SSXMLElement::SSXMLElement(const QString &name, SSXMLElement *parent);/*{{{*/
@@ -461,7 +1110,7 @@ inline SSXMLElement::SSXMLElement(const SSXMLElement &other, SSXMLElement *paren
  * @since 1.1
  *//* --------------------------------------------------------------------- */
 inline SSXMLElement::SSXMLElement(const QString &name, SSXMLElement *parent) :
-    elementName(name), parentElement(parent) { }
+    elementName(name), parentElement(parent), m_names(NULL), m_watchers(0), m_watched(false) { }
 /*}}}*/
 // inline SSXMLElement::~SSXMLElement();/*{{{*/
 /**
@@ -470,6 +1119,7 @@ inline SSXMLElement::SSXMLElement(const QString &name, SSXMLElement *parent) :
  *//* --------------------------------------------------------------------- */
 inline SSXMLElement::~SSXMLElement() {
     qDeleteAll(m_nodes);
+    delete m_names.load();
 }
 /*}}}*/
 ///@} Constructors & Destructor /*}}}*/
@@ -509,7 +1159,23 @@ inline QString SSXMLElement::text() const {
 // inline bool    SSXMLElement::text(const QString &elementText);/*{{{*/
 inline bool SSXMLElement::text(const QString &elementText) {
     if (hasChildren()) return false;
-    m_text = elementText; return true;
+    if (!watched()) { m_text = elementText; return true; }
+
+    QString previous = m_text;
+    m_text = elementText;
+    notify(SSXML_TEXT_CHANGED, this, -1, QString(), &previous);
+    return true;
+}
+/*}}}*/
+// inline const QHash<QString, QString>& SSXMLElement::attributes() const;/*{{{*/
+inline const QHash<QString, QString>& SSXMLElement::attributes() const {
+    return m_attrs;
+}
+/*}}}*/
+// inline const QString* SSXMLElement::find(const QString &attrName) const;/*{{{*/
+inline const QString* SSXMLElement::find(const QString &attrName) const {
+    QHash<QString, QString>::const_iterator it = m_attrs.constFind(attrName);
+    return ((it == m_attrs.cend()) ? NULL : &it.value());
 }
 /*}}}*/
 ///@} Attributes /*}}}*/
@@ -533,5 +1199,24 @@ inline SSXMLElement& SSXMLElement::operator =(const SSXMLElement &other) {
 /*}}}*/
 ///@} Overloaded Operators /*}}}*/
 /* ------------------------------------------------------------------------ */
+/*! \name Change Notification *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline bool SSXMLElement::watched() const;/*{{{*/
+inline bool SSXMLElement::watched() const {
+    return m_watched;
+}
+/*}}}*/
+// inline void SSXMLElement::notify(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);/*{{{*/
+inline void SSXMLElement::notify(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous) {
+    if (!watched()) return;
+
+    SSXMLElement *root = this;
+    while (root->parentElement) root = root->parentElement;
+
+    root->changed(change, element, index, name, previous);
+}
+/*}}}*/
+///@} Change Notification /*}}}*/
+/* ------------------------------------------------------------------------ */
 /* }}} Inlined Functions */
 #endif /* __SSQTXMLE_HPP_DEFINED__ */
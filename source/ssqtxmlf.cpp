@@ -0,0 +1,205 @@
+/**
+ * \file
+ * Defines the SSXMLFeed class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlf.hpp"
+
+/* ===========================================================================
+ * SSXMLFeed class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLFeed::SSXMLFeed();/*{{{*/
+/**
+ * Default constructor.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLFeed::SSXMLFeed() : m_current(NULL), m_depth(0), m_result(SSE_AGAIN)
+{
+}
+/*}}}*/
+// SSXMLFeed::~SSXMLFeed();/*{{{*/
+/**
+ * Destructor.
+ * Releases the partial tree.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLFeed::~SSXMLFeed()
+{
+    release();
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLFeed::addData(const QByteArray &data);/*{{{*/
+error_t SSXMLFeed::addData(const QByteArray &data)
+{
+    if (m_result != SSE_AGAIN)
+        return m_result;
+
+    m_reader.addData(data);
+    return parse();
+}
+/*}}}*/
+// error_t SSXMLFeed::addData(QIODevice *device);/*{{{*/
+error_t SSXMLFeed::addData(QIODevice *device)
+{
+    if (!device) return SSE_INVAL;
+    return addData(device->readAll());
+}
+/*}}}*/
+// void SSXMLFeed::clear();/*{{{*/
+void SSXMLFeed::clear()
+{
+    release();
+
+    m_reader.clear();
+    m_root.elementName.clear();
+    m_root.removeAllAttributes();
+    m_root.removeAllElements();
+    m_root.text(QString());
+
+    m_current = NULL;
+    m_depth   = 0;
+    m_result  = SSE_AGAIN;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Overridables */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLFeed::completed(SSXMLElement *element);/*{{{*/
+void SSXMLFeed::completed(SSXMLElement *element)
+{
+    m_root.append(element);
+}
+/*}}}*/
+///@} Overridables
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLFeed::parse();/*{{{*/
+/**
+ * Parses the data already added to the reader.
+ * @returns The same of #addData().
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+error_t SSXMLFeed::parse()
+{
+    QXmlStreamReader::TokenType type;
+    SSXMLElement *element;
+
+    forever
+    {
+        type = m_reader.readNext();
+
+        if (type == QXmlStreamReader::Invalid)
+        {
+            if (m_reader.error() == QXmlStreamReader::PrematureEndOfDocumentError)
+                return SSE_AGAIN;       /* Waiting for more data. */
+
+            sstrace("%s\n", SST(m_reader.errorString()));
+            ssprint("=> at line: %d, column: %d", (int)m_reader.lineNumber(), (int)m_reader.columnNumber());
+
+            if ((m_reader.error() == QXmlStreamReader::NotWellFormedError) ||
+                (m_reader.error() == QXmlStreamReader::UnexpectedElementError))
+                m_result = SSE_FTYPE;
+            else
+                m_result = SSE_FAULT;
+
+            return m_result;
+        }
+        else if (type == QXmlStreamReader::StartElement)
+        {
+            if (m_depth == 0)
+            {
+                element = &m_root;
+                element->elementName = m_reader.name().toString();
+            }
+            else
+            {
+                element = new SSXMLElement(m_reader.name().toString());
+
+                /* Children of the root are linked only when completed. */
+                if (m_depth == 1)
+                    element->parentElement = &m_root;
+                else
+                    m_current->append(element);
+            }
+
+            QXmlStreamAttributes attributes = m_reader.attributes();
+            size_t limit = attributes.count();
+
+            element->reserveAttributes(limit);
+            for (size_t i = 0; i < limit; ++i)
+                element->set(attributes[i].name().toString(), attributes[i].value().toString());
+
+            m_current = element;
+            m_depth++;
+        }
+        else if (type == QXmlStreamReader::EndElement)
+        {
+            element   = m_current;
+            m_current = m_current->parentElement;
+
+            if (--m_depth == 0)
+            {
+                m_current = NULL;
+                m_result  = SSNO_ERROR;
+                return m_result;
+            }
+            else if (m_depth == 1)
+                completed(element);
+        }
+        else if ((type == QXmlStreamReader::Characters) && (m_current != NULL))
+        {
+            /* White space between the root's children is not kept. */
+            if ((m_depth > 1) || !m_reader.isWhitespace())
+                m_current->text(m_reader.text().toString());
+        }
+    }
+}
+/*}}}*/
+// void SSXMLFeed::release();/*{{{*/
+/**
+ * Deletes the child of the root element still being built, if any.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLFeed::release()
+{
+    if (m_depth < 2) return;
+
+    SSXMLElement *element = m_current;
+    while (element->parentElement != &m_root)
+        element = element->parentElement;
+
+    delete element;
+    m_current = &m_root;
+    m_depth   = 1;
+}
+/*}}}*/
+///@} Implementation
+
@@ -0,0 +1,179 @@
+/**
+ * \file
+ * Declares the SSXMLFeed class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLF_HPP_DEFINED__
+#define __SSQTXMLF_HPP_DEFINED__
+
+#include <QByteArray>
+#include <QIODevice>
+#include <QXmlStreamReader>
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtxmle.hpp"
+
+/**
+ * @ingroup ssqt_xml
+ * Incremental XML parser fed with chunks of data.
+ * Data is passed to #addData() as it arrives, in chunks of any size. A chunk
+ * can end in the middle of a tag or of a text. The partial tree is kept
+ * between calls and parsing resumes where it stopped.
+ *
+ * The root element of the stream is the #rootElement(). Each time a child
+ * of the root element is completed the virtual function #completed() is
+ * called with it. Processing can happen while the rest of the stream is still
+ * being received. The default implementation appends the element to the
+ * root element, building the whole document.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * class MessageFeed : public SSXMLFeed
+ * {
+ * protected:
+ *     void completed(SSXMLElement *element) {
+ *         dispatch(element);
+ *         delete element;
+ *     }
+ * };
+ *
+ * // Connected to QLocalSocket::readyRead():
+ * void Connection::onReadyRead() {
+ *     error_t result = m_feed.addData(m_socket->readAll());
+ *     if ((result != SSNO_ERROR) && (result != SSE_AGAIN))
+ *         m_socket->abort();
+ * }
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLFeed
+{
+public:
+    SSXMLFeed();
+    virtual ~SSXMLFeed();
+
+public:         // Attributes
+    // const SSXMLElement* rootElement() const;/*{{{*/
+    /**
+     * The root element of the stream.
+     * @returns The root element. Before its start tag is received the
+     * element has no name. It has the children passed to the default
+     * implementation of #completed().
+     * @since 1.1
+     **/
+    const SSXMLElement* rootElement() const;
+    /*}}}*/
+    // size_t depth() const;/*{{{*/
+    /**
+     * Number of elements open at this moment.
+     * @returns Zero before the root element starts and after it ends.
+     * @since 1.1
+     **/
+    size_t depth() const;
+    /*}}}*/
+    // bool isFinished() const;/*{{{*/
+    /**
+     * Checks whether the root element was closed.
+     * @returns \b true when the stream is complete. \b false while more data
+     * is expected or after an error.
+     * @since 1.1
+     **/
+    bool isFinished() const;
+    /*}}}*/
+
+public:         // Operations
+    // error_t addData(const QByteArray &data);/*{{{*/
+    /**
+     * Parses a chunk of data.
+     * @param data The next chunk of the stream.
+     * @return One of the following values:
+     * - \b SSNO_ERROR: The root element was closed. The stream is complete.
+     * - \b SSE_AGAIN: All data was parsed. More is needed to complete the
+     *      document.
+     * - \b SSE_FTYPE: The stream is ill-formed.
+     * - \b SSE_FAULT: Any other kind of error.
+     * .
+     * After an error, or after the stream is complete, further calls return
+     * the same result until #clear() is called.
+     * @since 1.1
+     **/
+    error_t addData(const QByteArray &data);
+    /*}}}*/
+    // error_t addData(QIODevice *device);/*{{{*/
+    /**
+     * Parses the data available in a device.
+     * @param device The device to read. Only the bytes available are read,
+     * so the call doesn't block.
+     * @return The same of #addData(const QByteArray&).
+     * @since 1.1
+     **/
+    error_t addData(QIODevice *device);
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Discards the partial tree and prepares to parse a new stream.
+     * @since 1.1
+     **/
+    void clear();
+    /*}}}*/
+
+protected:      // Overridables
+    // virtual void completed(SSXMLElement *element);/*{{{*/
+    /**
+     * Called when a child of the root element is complete.
+     * @param element The completed element, with its whole subtree. The
+     * function takes ownership of the object. Its #parentElement member
+     * points to the root element, but the element is not in the root's list
+     * of children.
+     * @remarks The default implementation appends \a element to the root
+     * element.
+     * @since 1.1
+     **/
+    virtual void completed(SSXMLElement *element);
+    /*}}}*/
+
+protected:      // Implementation
+    error_t parse();
+    void    release();
+
+protected:      // Data Members
+    QXmlStreamReader m_reader;          /**< The incremental reader.        */
+    SSXMLElement  m_root;               /**< Root element of the stream.    */
+    SSXMLElement *m_current;            /**< Innermost open element.        */
+    size_t  m_depth;                    /**< Number of open elements.       */
+    error_t m_result;                   /**< Final result, when known.      */
+
+private:
+    Q_DISABLE_COPY(SSXMLFeed)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLFeed *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline const SSXMLElement* SSXMLFeed::rootElement() const;/*{{{*/
+inline const SSXMLElement* SSXMLFeed::rootElement() const {
+    return &m_root;
+}
+/*}}}*/
+// inline size_t SSXMLFeed::depth() const;/*{{{*/
+inline size_t SSXMLFeed::depth() const {
+    return m_depth;
+}
+/*}}}*/
+// inline bool SSXMLFeed::isFinished() const;/*{{{*/
+inline bool SSXMLFeed::isFinished() const {
+    return (m_result == SSNO_ERROR);
+}
+/*}}}*/
+///@} SSXMLFeed /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLF_HPP_DEFINED__ */
@@ -0,0 +1,266 @@
+/**
+ * \file
+ * Defines the SSXMLJournal class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmld.hpp"
+#include "ssqtxmlj.hpp"
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static void __xml_pathOf(const SSXMLElement *element, QVector<int> *path);/*{{{*/
+/**
+ * Computes the path of an element from the root of its tree.
+ * @param element The element.
+ * @param path Receives the index of \a element and of each of its ancestors,
+ * starting at the child of the root.
+ * @since 1.1
+ **/
+static void __xml_pathOf(const SSXMLElement *element, QVector<int> *path);
+/*}}}*/
+
+/* ===========================================================================
+ * SSXMLJournal class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLJournal::~SSXMLJournal();/*{{{*/
+SSXMLJournal::~SSXMLJournal()
+{
+    if (m_document != NULL)
+        m_document->journal(NULL);
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// QList<SSXMLChange> SSXMLJournal::drain(size_t limit = 0);/*{{{*/
+QList<SSXMLChange> SSXMLJournal::drain(size_t limit)
+{
+    QList<SSXMLChange> changes;
+
+    if ((limit == 0) || (limit >= (size_t)m_changes.count()))
+        changes.swap(m_changes);
+    else
+    {
+        changes = m_changes.mid(0, (int)limit);
+        m_changes.erase(m_changes.begin(), m_changes.begin() + (int)limit);
+    }
+    return changes;
+}
+/*}}}*/
+// bool SSXMLJournal::revert(const QList<SSXMLChange> &changes);/*{{{*/
+bool SSXMLJournal::revert(const QList<SSXMLChange> &changes)
+{
+    if (m_document == NULL) return false;
+
+    for (size_t i = changes.count(); i > 0; --i)
+    {
+        if (!revert(changes.at(i - 1)))
+        {
+            sstrace("Change %u at %d doesn't apply", changes.at(i - 1).type, (int)(i - 1));
+            return false;
+        }
+    }
+    return true;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Overridables */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLJournal::recorded(const SSXMLChange &change);/*{{{*/
+void SSXMLJournal::recorded(const SSXMLChange &change)
+{
+    m_changes.append(change);
+}
+/*}}}*/
+///@} Overridables
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLJournal::record(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);/*{{{*/
+/**
+ * Records a change reported by the document.
+ * @param change Kind of change.
+ * @param element The element changed. For child changes, the child added or
+ * about to be removed.
+ * @param index Position of the child for child changes.
+ * @param name Name of the attribute changed.
+ * @param previous Previous value of the attribute or text. \b NULL when
+ * there was none.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLJournal::record(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous)
+{
+    bool childChange = ((change == SSXML_CHILD_ADDED) || (change == SSXML_CHILD_REMOVED));
+
+    /* Paths of elements below the parent may have changed. The path of the
+     * parent itself didn't. */
+    if (childChange && (element->parentElement != m_last))
+        m_last = NULL;
+
+    if (m_paused) return;
+
+    SSXMLChange entry;
+
+    entry.type    = change;
+    entry.index   = -1;
+    entry.name    = name;
+    entry.existed = (previous != NULL);
+
+    if (previous != NULL)
+        entry.previous = *previous;
+
+    switch (change)
+    {
+    case SSXML_ATTRIBUTE_CHANGED:
+        entry.value = element->attribute(name);
+        break;
+    case SSXML_TEXT_CHANGED:
+        entry.value = element->text();
+        break;
+    case SSXML_CHILD_ADDED:
+    case SSXML_CHILD_REMOVED:
+        entry.index = index;
+
+        /* Filled when the child leaves the tree. See release(). */
+        if ((change == SSXML_CHILD_REMOVED) && m_keepRemoved)
+        {
+            QSharedPointer<SSXMLElement> subtree(new SSXMLElement());
+
+            m_pending.insert(element, subtree);
+            entry.subtree = subtree;
+        }
+
+        element = element->parentElement;
+        break;
+    }
+
+    if (element != m_last)
+    {
+        __xml_pathOf(element, &m_path);
+        m_last = element;
+    }
+
+    entry.element = element;
+    entry.path    = m_path;
+
+    recorded(entry);
+}
+/*}}}*/
+// void SSXMLJournal::release(SSXMLElement *element, bool owned);/*{{{*/
+/**
+ * Keeps a removed child that left the document.
+ * @param element The child.
+ * @param owned \b true when \a element is deleted after this call. Its
+ * content is moved to the recorded change. Otherwise it is copied.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLJournal::release(SSXMLElement *element, bool owned)
+{
+    QSharedPointer<SSXMLElement> subtree = m_pending.take(element);
+    if (subtree.isNull()) return;
+
+    if (owned)
+        subtree->exchange(element);
+    else
+        subtree->assign(element);
+}
+/*}}}*/
+// bool SSXMLJournal::revert(const SSXMLChange &change);/*{{{*/
+/**
+ * Undoes a single change.
+ * @param change The change.
+ * @returns \b true on success. \b false when the change doesn't apply to the
+ * document.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLJournal::revert(const SSXMLChange &change)
+{
+    SSXMLElement *element = resolve(change.path);
+    if (element == NULL) return false;
+
+    switch (change.type)
+    {
+    case SSXML_ATTRIBUTE_CHANGED:
+    case SSXML_ATTRIBUTE_REMOVED:
+        if (change.existed)
+            element->set(change.name, change.previous);
+        else
+            element->remove(change.name);
+        return true;
+    case SSXML_TEXT_CHANGED:
+        return element->text(change.previous);
+    case SSXML_CHILD_ADDED:
+        return element->remove((uint)change.index);
+    case SSXML_CHILD_REMOVED:
+        if (change.subtree.isNull() || (change.index > (int)element->numberOfChildren()))
+            return false;
+
+        element->insert((uint)change.index, *change.subtree);
+        return true;
+    }
+    return false;
+}
+/*}}}*/
+// SSXMLElement* SSXMLJournal::resolve(const QVector<int> &path) const;/*{{{*/
+/**
+ * Finds an element of the document by its path.
+ * @param path The path, as computed when the change was recorded.
+ * @returns The element or \b NULL when the path doesn't exist.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLElement* SSXMLJournal::resolve(const QVector<int> &path) const
+{
+    SSXMLElement *element = m_document;
+    size_t limit = path.count();
+
+    for (size_t i = 0; (i < limit) && (element != NULL); ++i)
+        element = element->elementAt((uint)path.at(i));
+
+    return element;
+}
+/*}}}*/
+///@} Implementation
+
+// static void __xml_pathOf(const SSXMLElement *element, QVector<int> *path);/*{{{*/
+static void __xml_pathOf(const SSXMLElement *element, QVector<int> *path)
+{
+    path->clear();
+
+    while (element->parentElement != NULL)
+    {
+        path->append(element->parentElement->indexOf(element));
+        element = element->parentElement;
+    }
+
+    size_t limit = path->count() / 2;
+    size_t last  = path->count() - 1;
+
+    for (size_t i = 0; i < limit; ++i)
+        qSwap((*path)[i], (*path)[last - i]);
+}
+/*}}}*/
+
@@ -0,0 +1,292 @@
+/**
+ * \file
+ * Declares the SSXMLJournal class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLJ_HPP_DEFINED__
+#define __SSQTXMLJ_HPP_DEFINED__
+
+#include <QString>
+#include <QList>
+#include <QVector>
+#include <QHash>
+#include <QSharedPointer>
+#include "ssqtcmn.hpp"
+#include "ssqtxmle.hpp"
+
+class SSXMLDocument;
+
+/**
+ * @ingroup ssqt_xml
+ * A change recorded by SSXMLJournal.
+ * Elements are addressed by their path from the root of the document, so a
+ * change can be applied again after the element it refers to was deleted and
+ * restored from a copy.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+struct SSXMLChange
+{
+    uint          type;     /**< One of the \c SSXML_ATTRIBUTE_CHANGED,
+                              \c SSXML_ATTRIBUTE_REMOVED, \c SSXML_CHILD_ADDED,
+                              \c SSXML_CHILD_REMOVED or \c SSXML_TEXT_CHANGED
+                              values. */
+    SSXMLElement *element;  /**< The element changed. For child changes, the
+                              parent. Valid only while the tree is not
+                              changed again. */
+    QVector<int>  path;     /**< Indexes of #element and its ancestors, from
+                              the root. Empty for the root itself. */
+    int           index;    /**< Position of the child added or removed.
+                              -1 for other changes. */
+    QString       name;     /**< Attribute name. */
+    QString       value;    /**< New attribute value or text. */
+    QString       previous; /**< Previous attribute value or text. */
+    bool          existed;  /**< The attribute existed before the change. */
+    QSharedPointer<const SSXMLElement> subtree; /**< The child removed, when
+                              SSXMLJournal::keepRemoved() is set. Empty
+                              until the child leaves the tree, that happens
+                              after SSXMLJournal::recorded() is called. */
+};
+
+/**
+ * @ingroup ssqt_xml
+ * Records the changes made to a document.
+ * A journal is set in a document with SSXMLDocument::journal(). Every change
+ * made through SSXMLElement member functions in any element of the document
+ * is then recorded, in the order it happens. A single operation can record
+ * several changes: appending a child to an element with text records the
+ * text being cleared and the child being added.
+ *
+ * Changes are drained in batches with #drain(). A batch can be passed to
+ * #revert() to undo it. Reverting records the inverse changes, that are
+ * drained as another batch. Reverting them redoes the original batch:
+ * ~~~~~~~~~~~~~~{.cpp}
+ * SSXMLJournal journal;
+ * document.journal(&journal);
+ *
+ * document.elementAt(0)->set("name", "new");
+ * QList<SSXMLChange> edit = journal.drain();
+ *
+ * journal.revert(edit);                        // Undo.
+ * QList<SSXMLChange> undo = journal.drain();
+ *
+ * journal.revert(undo);                        // Redo.
+ * ~~~~~~~~~~~~~~
+ * Observers override #recorded(). The default implementation keeps the
+ * change until it is drained.
+ * @remarks Removed children are kept, so they can be restored. Children
+ * deleted by the removal are moved to the journal, not copied. Children
+ * taken from the document with SSXMLElement::take() or moved with
+ * SSXMLElement::splice() stay with the caller and are copied. Keeping them
+ * can be disabled with #keepRemoved() when only observing.
+ * @remarks The path of the last element changed is kept, so a sequence of
+ * changes in the same element, like removing all its children, doesn't
+ * search for its position again.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLJournal
+{
+public:
+    // SSXMLJournal();/*{{{*/
+    /**
+     * Default constructor.
+     * @since 1.1
+     **/
+    SSXMLJournal();
+    /*}}}*/
+    // virtual ~SSXMLJournal();/*{{{*/
+    /**
+     * Destructor.
+     * Removes the journal from its document.
+     * @since 1.1
+     **/
+    virtual ~SSXMLJournal();
+    /*}}}*/
+
+public:         // Attributes
+    // SSXMLDocument* document() const;/*{{{*/
+    /**
+     * The document recorded.
+     * @returns The document this journal was set in or \b NULL.
+     * @since 1.1
+     **/
+    SSXMLDocument* document() const;
+    /*}}}*/
+    // bool isEmpty() const;/*{{{*/
+    /**
+     * Checks whether there are changes to drain.
+     * @since 1.1
+     **/
+    bool isEmpty() const;
+    /*}}}*/
+    // size_t count() const;/*{{{*/
+    /**
+     * Number of changes to drain.
+     * @since 1.1
+     **/
+    size_t count() const;
+    /*}}}*/
+    // bool keepRemoved() const;/*{{{*/
+    /**
+     * Checks whether removed children are kept.
+     * @returns \b true, the default, when SSXMLChange::subtree is set for
+     * removed children.
+     * @since 1.1
+     **/
+    bool keepRemoved() const;
+    /*}}}*/
+    // void keepRemoved(bool enable);/*{{{*/
+    /**
+     * Sets whether removed children are kept.
+     * @param enable \b false to not keep them. Changes recorded this way
+     * can't be reverted.
+     * @since 1.1
+     **/
+    void keepRemoved(bool enable);
+    /*}}}*/
+    // bool isPaused() const;/*{{{*/
+    /**
+     * Checks whether recording is paused.
+     * @since 1.1
+     **/
+    bool isPaused() const;
+    /*}}}*/
+    // void pause(bool paused);/*{{{*/
+    /**
+     * Pauses or resumes recording.
+     * @param paused \b true to ignore the changes made to the document.
+     * @remarks Reverting a batch while recording is paused doesn't record
+     * the inverse changes.
+     * @since 1.1
+     **/
+    void pause(bool paused);
+    /*}}}*/
+
+public:         // Operations
+    // QList<SSXMLChange> drain(size_t limit = 0);/*{{{*/
+    /**
+     * Takes the recorded changes.
+     * @param limit Maximum number of changes to take. Zero takes all.
+     * @returns The oldest changes, in the order they were recorded. They
+     * are removed from the journal.
+     * @since 1.1
+     **/
+    QList<SSXMLChange> drain(size_t limit = 0);
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Discards the recorded changes.
+     * @since 1.1
+     **/
+    void clear();
+    /*}}}*/
+    // bool revert(const QList<SSXMLChange> &changes);/*{{{*/
+    /**
+     * Undoes a batch of changes.
+     * @param changes Changes drained from this journal, in the order they
+     * were drained. They are undone from the last to the first.
+     * @returns \b true on success. \b false when the journal is not set in
+     * a document, or a change doesn't apply to the document as it is. In
+     * this case the changes after the failed one were undone already.
+     * @remarks Batches must be reverted in the reverse order they were
+     * drained. Changes made to the document after a batch was drained
+     * must be reverted before it.
+     * @since 1.1
+     **/
+    bool revert(const QList<SSXMLChange> &changes);
+    /*}}}*/
+
+protected:      // Overridables
+    // virtual void recorded(const SSXMLChange &change);/*{{{*/
+    /**
+     * Called for each change made to the document.
+     * @param change The change. SSXMLChange::element and the path are
+     * valid during this call. SSXMLChange::subtree is still empty.
+     * @remarks The default implementation keeps the change until it is
+     * drained. Overrides that don't call it keep nothing.
+     * @since 1.1
+     **/
+    virtual void recorded(const SSXMLChange &change);
+    /*}}}*/
+
+protected:      // Implementation
+    void record(uint change, SSXMLElement *element, int index, const QString &name, const QString *previous);
+    void release(SSXMLElement *element, bool owned);
+    bool revert(const SSXMLChange &change);
+    SSXMLElement* resolve(const QVector<int> &path) const;
+
+protected:      // Data Members
+    SSXMLDocument     *m_document;      /**< Document recorded.             */
+    QList<SSXMLChange> m_changes;       /**< Changes not drained.           */
+    QHash<const SSXMLElement*, QSharedPointer<SSXMLElement> > m_pending; /**< Removed children not released yet. */
+    SSXMLElement      *m_last;          /**< Last element changed.          */
+    QVector<int>       m_path;          /**< Path of #m_last.               */
+    bool m_keepRemoved;                 /**< Copy removed children.         */
+    bool m_paused;                      /**< Recording is paused.           */
+
+    friend class SSXMLDocument;
+
+private:
+    Q_DISABLE_COPY(SSXMLJournal)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLJournal *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLJournal::SSXMLJournal();/*{{{*/
+inline SSXMLJournal::SSXMLJournal() : m_document(NULL), m_last(NULL), m_keepRemoved(true), m_paused(false) { }
+/*}}}*/
+// inline SSXMLDocument* SSXMLJournal::document() const;/*{{{*/
+inline SSXMLDocument* SSXMLJournal::document() const {
+    return m_document;
+}
+/*}}}*/
+// inline bool SSXMLJournal::isEmpty() const;/*{{{*/
+inline bool SSXMLJournal::isEmpty() const {
+    return m_changes.isEmpty();
+}
+/*}}}*/
+// inline size_t SSXMLJournal::count() const;/*{{{*/
+inline size_t SSXMLJournal::count() const {
+    return m_changes.count();
+}
+/*}}}*/
+// inline bool SSXMLJournal::keepRemoved() const;/*{{{*/
+inline bool SSXMLJournal::keepRemoved() const {
+    return m_keepRemoved;
+}
+/*}}}*/
+// inline void SSXMLJournal::keepRemoved(bool enable);/*{{{*/
+inline void SSXMLJournal::keepRemoved(bool enable) {
+    m_keepRemoved = enable;
+}
+/*}}}*/
+// inline bool SSXMLJournal::isPaused() const;/*{{{*/
+inline bool SSXMLJournal::isPaused() const {
+    return m_paused;
+}
+/*}}}*/
+// inline void SSXMLJournal::pause(bool paused);/*{{{*/
+inline void SSXMLJournal::pause(bool paused) {
+    m_paused = paused;
+}
+/*}}}*/
+// inline void SSXMLJournal::clear();/*{{{*/
+inline void SSXMLJournal::clear() {
+    m_changes.clear();
+    m_last = NULL;
+}
+/*}}}*/
+///@} SSXMLJournal /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLJ_HPP_DEFINED__ */
@@ -0,0 +1,512 @@
+/**
+ * \file
+ * Defines the SSXMLQuery class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlq.hpp"
+
+/**
+ * @internal
+ * Axes of a step.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_AXIS_CHILD        0   /**< Children of the context.           */
+#define SSXML_AXIS_DESCENDANT   1   /**< Descendants of the context.        */
+#define SSXML_AXIS_SELF         2   /**< The context itself.                */
+///@}
+
+/**
+ * @internal
+ * Kinds of predicates.
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_TEST_HAS          0   /**< Attribute exists.                  */
+#define SSXML_TEST_EQUAL        1   /**< Attribute has a value.             */
+#define SSXML_TEST_NOT_EQUAL    2   /**< Attribute has another value.       */
+#define SSXML_TEST_POSITION     3   /**< Position among siblings.           */
+///@}
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static int __xml_skipSpaces(const QChar *data, int length, int index);/*{{{*/
+/**
+ * Skips white space.
+ * @param data The expression.
+ * @param length Number of characters in \a data.
+ * @param index Index where to start.
+ * @returns The index of the first character that is not a space.
+ * @since 1.1
+ **/
+static int __xml_skipSpaces(const QChar *data, int length, int index);
+/*}}}*/
+// static int __xml_scanName(const QChar *data, int length, int index);/*{{{*/
+/**
+ * Scans an element or attribute name.
+ * @param data The expression.
+ * @param length Number of characters in \a data.
+ * @param index Index where the name starts.
+ * @returns The index just past the name. Equals to \a index when there is no
+ * name there.
+ * @since 1.1
+ **/
+static int __xml_scanName(const QChar *data, int length, int index);
+/*}}}*/
+
+/* ===========================================================================
+ * SSXMLQuery class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLQuery::compile(const QString &expression);/*{{{*/
+error_t SSXMLQuery::compile(const QString &expression)
+{
+    const QChar *data = expression.constData();
+    int    length = expression.length();
+    int    index, end;
+    uint   axis = SSXML_AXIS_CHILD;
+    size_t descendantSteps = 0;
+    bool   failed = false;
+    QChar  quote;
+
+    m_steps.clear();
+    m_predicates.clear();
+    m_expression.clear();
+    m_absolute = false;
+    m_unique   = false;
+    m_valid    = false;
+
+    index = __xml_skipSpaces(data, length, 0);
+    if ((index < length) && (data[index] == '/'))
+    {
+        m_absolute = true;
+        if (((index + 1) < length) && (data[index + 1] == '/'))
+        {
+            axis   = SSXML_AXIS_DESCENDANT;
+            index += 2;
+        }
+        else
+            index++;
+    }
+
+    while (index < length)
+    {
+        Step step;
+
+        step.axis  = axis;
+        step.first = m_predicates.count();
+        step.count = 0;
+
+        if (data[index] == '.')
+        {
+            if (axis == SSXML_AXIS_DESCENDANT) break;
+            step.axis = SSXML_AXIS_SELF;
+            index++;
+        }
+        else if (data[index] == '*')
+            index++;
+        else
+        {
+            end = __xml_scanName(data, length, index);
+            if (end == index) break;
+
+            step.name = expression.mid(index, end - index);
+            index = end;
+        }
+
+        while ((index < length) && (data[index] == '['))
+        {
+            Predicate predicate;
+
+            predicate.position = 0;
+            index = __xml_skipSpaces(data, length, index + 1);
+
+            if ((index < length) && (data[index] == '@'))
+            {
+                end = __xml_scanName(data, length, index + 1);
+                if (end == (index + 1))
+                {
+                    failed = true;
+                    break;
+                }
+
+                predicate.name = expression.mid(index + 1, end - index - 1);
+                index = __xml_skipSpaces(data, length, end);
+
+                if ((index < length) && (data[index] == '='))
+                {
+                    predicate.type = SSXML_TEST_EQUAL;
+                    index++;
+                }
+                else if (((index + 1) < length) && (data[index] == '!') && (data[index + 1] == '='))
+                {
+                    predicate.type = SSXML_TEST_NOT_EQUAL;
+                    index += 2;
+                }
+                else
+                    predicate.type = SSXML_TEST_HAS;
+
+                if (predicate.type != SSXML_TEST_HAS)
+                {
+                    index = __xml_skipSpaces(data, length, index);
+                    if ((index >= length) || ((data[index] != '\'') && (data[index] != '"')))
+                    {
+                        failed = true;
+                        break;
+                    }
+
+                    quote = data[index];
+                    end   = expression.indexOf(quote, index + 1);
+                    if (end < 0)
+                    {
+                        failed = true;
+                        break;
+                    }
+
+                    predicate.value = expression.mid(index + 1, end - index - 1);
+                    index = end + 1;
+                }
+            }
+            else
+            {
+                for (end = index; (end < length) && data[end].isDigit(); ++end) ;
+
+                predicate.type     = SSXML_TEST_POSITION;
+                predicate.position = expression.mid(index, end - index).toUInt();
+                if (predicate.position == 0)
+                {
+                    failed = true;
+                    break;
+                }
+
+                index = end;
+            }
+
+            index = __xml_skipSpaces(data, length, index);
+            if ((index >= length) || (data[index] != ']'))
+            {
+                failed = true;
+                break;
+            }
+
+            m_predicates.append(predicate);
+            step.count++;
+            index++;
+        }
+
+        if (failed || ((index < length) && (data[index] != '/'))) break;
+
+        /* Predicates are not allowed in '.' steps. */
+        if ((step.axis == SSXML_AXIS_SELF) && (step.count > 0)) break;
+
+        if (step.axis == SSXML_AXIS_DESCENDANT) descendantSteps++;
+        m_steps.append(step);
+
+        if (index >= length)
+        {
+            m_valid = true;
+            break;
+        }
+
+        if (((index + 1) < length) && (data[index + 1] == '/'))
+        {
+            axis   = SSXML_AXIS_DESCENDANT;
+            index += 2;
+        }
+        else
+        {
+            axis = SSXML_AXIS_CHILD;
+            index++;
+        }
+    }
+
+    /* A single '/' selects the root element. */
+    if (m_steps.isEmpty() && m_absolute && (axis == SSXML_AXIS_CHILD) && (index >= length))
+        m_valid = true;
+
+    if (!m_valid)
+    {
+        sstrace("Invalid query: '%s' at %d", SST(expression), index);
+        m_steps.clear();
+        m_predicates.clear();
+        return SSE_INVAL;
+    }
+
+    m_expression = expression;
+    m_unique     = (descendantSteps > 1);
+    return SSNO_ERROR;
+}
+/*}}}*/
+// SSXMLElement* SSXMLQuery::first(const SSXMLElement *context) const;/*{{{*/
+SSXMLElement* SSXMLQuery::first(const SSXMLElement *context) const
+{
+    Result result = { NULL, NULL, 1, 0, NULL };
+
+    run(context, &result);
+    return result.first;
+}
+/*}}}*/
+// size_t SSXMLQuery::select(const SSXMLElement *context, QList<SSXMLElement*> *result, size_t limit = 0) const;/*{{{*/
+size_t SSXMLQuery::select(const SSXMLElement *context, QList<SSXMLElement*> *result, size_t limit) const
+{
+    QSet<const SSXMLElement*> seen;
+    Result found = { result, NULL, limit, 0, (m_unique ? &seen : NULL) };
+
+    run(context, &found);
+    return found.count;
+}
+/*}}}*/
+// size_t SSXMLQuery::count(const SSXMLElement *context) const;/*{{{*/
+size_t SSXMLQuery::count(const SSXMLElement *context) const
+{
+    return select(context, NULL);
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLQuery::run(const SSXMLElement *context, Result *result) const;/*{{{*/
+/**
+ * Evaluates the query.
+ * @param context The element where relative paths start.
+ * @param result Receives the elements found.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLQuery::run(const SSXMLElement *context, Result *result) const
+{
+    if (!m_valid || !context) return;
+
+    if (!m_absolute)
+    {
+        evaluate(context, 0, result);
+        return;
+    }
+
+    const SSXMLElement *root = context;
+    while (root->parentElement)
+        root = root->parentElement;
+
+    if (m_steps.isEmpty())
+    {
+        add(root, result);
+        return;
+    }
+
+    /* The root element is the only child of the document itself. */
+    const Step &step = m_steps.first();
+    QVarLengthArray<uint, 8> positions(step.count);
+
+    memset(positions.data(), 0, step.count * sizeof(uint));
+
+    if (step.axis == SSXML_AXIS_SELF)
+        evaluate(root, 1, result);
+    else if (accept(root, step, positions.data()) && evaluate(root, 1, result))
+        return;
+    else if (step.axis == SSXML_AXIS_DESCENDANT)
+        descendants(root, 0, result);
+}
+/*}}}*/
+// bool SSXMLQuery::evaluate(const SSXMLElement *element, int index, Result *result) const;/*{{{*/
+/**
+ * Evaluates the query from a step.
+ * @param element The context element of the step.
+ * @param index Index of the step.
+ * @param result Receives the elements found.
+ * @returns \b true when the evaluation must stop.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLQuery::evaluate(const SSXMLElement *element, int index, Result *result) const
+{
+    if (index >= m_steps.count())
+        return add(element, result);
+
+    switch (m_steps.at(index).axis)
+    {
+    case SSXML_AXIS_SELF:
+        return evaluate(element, index + 1, result);
+    case SSXML_AXIS_DESCENDANT:
+        return descendants(element, index, result);
+    default:
+        return children(element, index, result);
+    }
+}
+/*}}}*/
+// bool SSXMLQuery::children(const SSXMLElement *element, int index, Result *result) const;/*{{{*/
+/**
+ * Evaluates a step over the children of an element.
+ * @param element The context element of the step.
+ * @param index Index of the step.
+ * @param result Receives the elements found.
+ * @returns \b true when the evaluation must stop.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLQuery::children(const SSXMLElement *element, int index, Result *result) const
+{
+    const Step &step = m_steps.at(index);
+    const SSXMLElement *child;
+    QVarLengthArray<uint, 8> positions(step.count);
+    size_t limit = element->m_nodes.count();
+
+    memset(positions.data(), 0, step.count * sizeof(uint));
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        child = element->m_nodes.at(i);
+        if (accept(child, step, positions.data()) && evaluate(child, index + 1, result))
+            return true;
+    }
+    return false;
+}
+/*}}}*/
+// bool SSXMLQuery::descendants(const SSXMLElement *element, int index, Result *result) const;/*{{{*/
+/**
+ * Evaluates a step over the descendants of an element.
+ * @param element The context element of the step.
+ * @param index Index of the step.
+ * @param result Receives the elements found.
+ * @returns \b true when the evaluation must stop.
+ * @remarks Positions are counted among the children of each element, as in
+ * XPath.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLQuery::descendants(const SSXMLElement *element, int index, Result *result) const
+{
+    const Step &step = m_steps.at(index);
+    const SSXMLElement *child;
+    QVarLengthArray<uint, 8> positions(step.count);
+    size_t limit = element->m_nodes.count();
+
+    memset(positions.data(), 0, step.count * sizeof(uint));
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        child = element->m_nodes.at(i);
+        if (accept(child, step, positions.data()) && evaluate(child, index + 1, result))
+            return true;
+
+        if (descendants(child, index, result))
+            return true;
+    }
+    return false;
+}
+/*}}}*/
+// bool SSXMLQuery::accept(const SSXMLElement *element, const Step &step, uint *positions) const;/*{{{*/
+/**
+ * Checks whether an element passes the tests of a step.
+ * @param element The element to check.
+ * @param step The step.
+ * @param positions Counters of the positional predicates of the step, one
+ * for each predicate. Updated by the call.
+ * @returns \b true when the element passes all the tests.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLQuery::accept(const SSXMLElement *element, const Step &step, uint *positions) const
+{
+    if (!step.name.isEmpty() && (element->elementName != step.name))
+        return false;
+
+    QHash<QString, QString>::const_iterator it;
+
+    for (int i = 0; i < step.count; ++i)
+    {
+        const Predicate &predicate = m_predicates.at(step.first + i);
+
+        switch (predicate.type)
+        {
+        case SSXML_TEST_HAS:
+            if (!element->m_attrs.contains(predicate.name))
+                return false;
+            break;
+        case SSXML_TEST_EQUAL:
+            it = element->m_attrs.constFind(predicate.name);
+            if ((it == element->m_attrs.cend()) || (it.value() != predicate.value))
+                return false;
+            break;
+        case SSXML_TEST_NOT_EQUAL:
+            it = element->m_attrs.constFind(predicate.name);
+            if ((it == element->m_attrs.cend()) || (it.value() == predicate.value))
+                return false;
+            break;
+        case SSXML_TEST_POSITION:
+            if (++positions[i] != predicate.position)
+                return false;
+            break;
+        }
+    }
+    return true;
+}
+/*}}}*/
+// bool SSXMLQuery::add(const SSXMLElement *element, Result *result) const;/*{{{*/
+/**
+ * Adds an element to the results.
+ * @param element The element found.
+ * @param result The results.
+ * @returns \b true when the limit of results was reached.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+bool SSXMLQuery::add(const SSXMLElement *element, Result *result) const
+{
+    SSXMLElement *found = const_cast<SSXMLElement*>(element);
+
+    if (result->seen)
+    {
+        int before = result->seen->count();
+
+        result->seen->insert(element);
+        if (result->seen->count() == before)
+            return false;               /* Reached by another path. */
+    }
+
+    if (result->list)
+        result->list->append(found);
+
+    if (!result->first) result->first = found;
+    result->count++;
+
+    return ((result->limit > 0) && (result->count >= result->limit));
+}
+/*}}}*/
+///@} Implementation
+
+// static int __xml_skipSpaces(const QChar *data, int length, int index);/*{{{*/
+static int __xml_skipSpaces(const QChar *data, int length, int index)
+{
+    while ((index < length) && data[index].isSpace())
+        index++;
+
+    return index;
+}
+/*}}}*/
+// static int __xml_scanName(const QChar *data, int length, int index);/*{{{*/
+static int __xml_scanName(const QChar *data, int length, int index)
+{
+    if ((index >= length) || !(data[index].isLetter() || (data[index] == '_')))
+        return index;
+
+    for (++index; index < length; ++index)
+    {
+        const QChar &c = data[index];
+        if (!c.isLetterOrNumber() && (c != '_') && (c != '-') && (c != '.') && (c != ':'))
+            break;
+    }
+    return index;
+}
+/*}}}*/
+
@@ -0,0 +1,207 @@
+/**
+ * \file
+ * Declares the SSXMLQuery class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLQ_HPP_DEFINED__
+#define __SSQTXMLQ_HPP_DEFINED__
+
+#include <QString>
+#include <QList>
+#include <QSet>
+#include <QVector>
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtxmle.hpp"
+
+/**
+ * @ingroup ssqt_xml
+ * Compiled query over an element tree.
+ * Queries are written in a subset of XPath and compiled once. The compiled
+ * query can be evaluated any number of times, against any element. The
+ * syntax supported is:
+ * - <tt>a/b</tt>: Elements \c b children of elements \c a, children of the
+ *   context element.
+ * - <tt>a//b</tt>: Elements \c b descendants of elements \c a.
+ * - <tt>/a</tt> and <tt>//a</tt>: Paths starting at the root of the tree
+ *   the context element belongs to.
+ * - <tt>*</tt>: Elements with any name. <tt>.</tt>: The element itself.
+ * - <tt>[@x]</tt>: Elements with the attribute \c x.
+ * - <tt>[@x='v']</tt> and <tt>[@x!='v']</tt>: Elements whose attribute \c x
+ *   is or is not equal to \c v. Double quotes can also be used.
+ * - <tt>[n]</tt>: The n-th element, starting at 1, among the siblings that
+ *   passed the previous tests of the step.
+ * .
+ * Evaluation walks the tree in document order and stops as soon as the
+ * requested number of elements is found. No memory is allocated while
+ * walking, except for the list of results.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * static const SSXMLQuery query("//server[@enabled='true'][1]/port");
+ *
+ * SSXMLElement *port = query.first(&document);
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLQuery
+{
+public:
+    // SSXMLQuery();/*{{{*/
+    /**
+     * Default constructor.
+     * Builds an invalid query, that doesn't select any element.
+     * @since 1.1
+     **/
+    SSXMLQuery();
+    /*}}}*/
+    // explicit SSXMLQuery(const QString &expression);/*{{{*/
+    /**
+     * Builds and compiles a query.
+     * @param expression The query expression.
+     * @remarks Use #isValid() to check whether the expression was compiled.
+     * @since 1.1
+     **/
+    explicit SSXMLQuery(const QString &expression);
+    /*}}}*/
+
+public:         // Attributes
+    // bool isValid() const;/*{{{*/
+    /**
+     * Checks whether the query was compiled successfully.
+     * @since 1.1
+     **/
+    bool isValid() const;
+    /*}}}*/
+    // QString expression() const;/*{{{*/
+    /**
+     * The compiled expression.
+     * @returns The expression passed to the last successful #compile().
+     * @since 1.1
+     **/
+    QString expression() const;
+    /*}}}*/
+
+public:         // Operations
+    // error_t compile(const QString &expression);/*{{{*/
+    /**
+     * Compiles an expression.
+     * @param expression The query expression.
+     * @return \b SSNO_ERROR on success. \b SSE_INVAL when the expression has
+     * a syntax error. In this case the query becomes invalid.
+     * @since 1.1
+     **/
+    error_t compile(const QString &expression);
+    /*}}}*/
+    // SSXMLElement* first(const SSXMLElement *context) const;/*{{{*/
+    /**
+     * Finds the first element selected by the query.
+     * @param context The element where relative paths start.
+     * @returns The element found or \b NULL.
+     * @since 1.1
+     **/
+    SSXMLElement* first(const SSXMLElement *context) const;
+    /*}}}*/
+    // size_t select(const SSXMLElement *context, QList<SSXMLElement*> *result, size_t limit = 0) const;/*{{{*/
+    /**
+     * Finds the elements selected by the query.
+     * @param context The element where relative paths start.
+     * @param result List where the elements found are appended. Can be \b
+     * NULL to only count them.
+     * @param limit Maximum number of elements to find. Zero means no limit.
+     * @returns The number of elements found.
+     * @remarks Queries with more than one \c // step can reach the same
+     * element by different paths. In this case the elements found are kept
+     * in a set so each element is added once, but the order of the results
+     * can differ from the document order.
+     * @since 1.1
+     **/
+    size_t select(const SSXMLElement *context, QList<SSXMLElement*> *result, size_t limit = 0) const;
+    /*}}}*/
+    // size_t count(const SSXMLElement *context) const;/*{{{*/
+    /**
+     * Counts the elements selected by the query.
+     * @param context The element where relative paths start.
+     * @returns The number of elements found.
+     * @since 1.1
+     **/
+    size_t count(const SSXMLElement *context) const;
+    /*}}}*/
+
+protected:
+    struct Step
+    {
+        uint    axis;                   /**< Axis of the step.              */
+        QString name;                   /**< Name test. Empty means any.    */
+        int     first;                  /**< First predicate.               */
+        int     count;                  /**< Number of predicates.          */
+    };
+
+    struct Predicate
+    {
+        uint    type;                   /**< Kind of test.                  */
+        QString name;                   /**< Attribute name.                */
+        QString value;                  /**< Attribute value.               */
+        uint    position;               /**< Position, starting at 1.       */
+    };
+
+    struct Result
+    {
+        QList<SSXMLElement*> *list;     /**< Elements found or NULL.        */
+        SSXMLElement *first;            /**< First element found.           */
+        size_t limit;                   /**< Maximum to find or zero.       */
+        size_t count;                   /**< Number of elements found.      */
+        QSet<const SSXMLElement*> *seen;/**< Elements found, when results
+                                          can repeat. Otherwise NULL.   */
+    };
+
+protected:      // Implementation
+    void run(const SSXMLElement *context, Result *result) const;
+    bool evaluate(const SSXMLElement *element, int index, Result *result) const;
+    bool children(const SSXMLElement *element, int index, Result *result) const;
+    bool descendants(const SSXMLElement *element, int index, Result *result) const;
+    bool accept(const SSXMLElement *element, const Step &step, uint *positions) const;
+    bool add(const SSXMLElement *element, Result *result) const;
+
+protected:      // Data Members
+    QVector<Step>      m_steps;         /**< Compiled steps.                */
+    QVector<Predicate> m_predicates;    /**< Predicates of all steps.       */
+    QString m_expression;               /**< Source expression.             */
+    bool    m_absolute;                 /**< Path starts at the root.       */
+    bool    m_unique;                   /**< Results can repeat.            */
+    bool    m_valid;                    /**< Compiled successfully.         */
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLQuery *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLQuery::SSXMLQuery();/*{{{*/
+inline SSXMLQuery::SSXMLQuery() : m_absolute(false), m_unique(false), m_valid(false) { }
+/*}}}*/
+// inline SSXMLQuery::SSXMLQuery(const QString &expression);/*{{{*/
+inline SSXMLQuery::SSXMLQuery(const QString &expression) : m_absolute(false), m_unique(false), m_valid(false) {
+    compile(expression);
+}
+/*}}}*/
+// inline bool SSXMLQuery::isValid() const;/*{{{*/
+inline bool SSXMLQuery::isValid() const {
+    return m_valid;
+}
+/*}}}*/
+// inline QString SSXMLQuery::expression() const;/*{{{*/
+inline QString SSXMLQuery::expression() const {
+    return m_expression;
+}
+/*}}}*/
+///@} SSXMLQuery /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLQ_HPP_DEFINED__ */
@@ -0,0 +1,282 @@
+/**
+ * \file
+ * Defines the SSXMLRecordReader class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlr.hpp"
+
+/* ===========================================================================
+ * SSXMLRecordReader class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLRecordReader::SSXMLRecordReader(QIODevice *device = NULL);/*{{{*/
+SSXMLRecordReader::SSXMLRecordReader(QIODevice *device) : m_record(NULL),
+    m_error(SSNO_ERROR), m_started(false), m_finished(false)
+{
+    if (device) m_reader.setDevice(device);
+}
+/*}}}*/
+// SSXMLRecordReader::~SSXMLRecordReader();/*{{{*/
+/**
+ * Destructor.
+ * Releases the current record and all elements kept for reuse.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLRecordReader::~SSXMLRecordReader()
+{
+    recycle(m_record);
+    qDeleteAll(m_pool);
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLRecordReader::setDevice(QIODevice *device);/*{{{*/
+void SSXMLRecordReader::setDevice(QIODevice *device)
+{
+    recycle(m_record);
+    m_record = NULL;
+
+    m_reader.setDevice(device);
+    m_root.elementName.clear();
+    m_root.removeAllAttributes();
+
+    m_error    = SSNO_ERROR;
+    m_started  = false;
+    m_finished = false;
+}
+/*}}}*/
+// SSXMLElement* SSXMLRecordReader::next();/*{{{*/
+SSXMLElement* SSXMLRecordReader::next()
+{
+    recycle(m_record);
+    m_record = NULL;
+
+    if (m_finished || (m_error != SSNO_ERROR))
+        return NULL;
+
+    forever
+    {
+        switch (m_reader.readNext())
+        {
+        case QXmlStreamReader::StartElement:
+            if (!m_started)
+            {
+                fill(&m_root);
+                m_started = true;
+            }
+            else if (!m_recordName.isEmpty() && (m_reader.name() != m_recordName))
+                m_reader.skipCurrentElement();
+            else
+            {
+                m_record = build();
+                return m_record;
+            }
+            break;
+        case QXmlStreamReader::EndElement:
+            m_finished = true;          /* End of the root element. */
+            return NULL;
+        case QXmlStreamReader::EndDocument:
+        case QXmlStreamReader::Invalid:
+            setError();
+            return NULL;
+        default:
+            break;
+        }
+    }
+}
+/*}}}*/
+// SSXMLElement* SSXMLRecordReader::takeRecord();/*{{{*/
+SSXMLElement* SSXMLRecordReader::takeRecord()
+{
+    SSXMLElement *element = m_record;
+
+    m_record = NULL;
+    return element;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLElement* SSXMLRecordReader::build();/*{{{*/
+/**
+ * Builds the record that starts at the current element.
+ * @returns The record or \b NULL on errors.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLElement* SSXMLRecordReader::build()
+{
+    SSXMLElement *record  = acquire();
+    SSXMLElement *current = record;
+    SSXMLElement *child;
+    size_t depth = 1;
+
+    fill(record);
+
+    while (depth > 0)
+    {
+        switch (m_reader.readNext())
+        {
+        case QXmlStreamReader::StartElement:
+            child = acquire();
+            fill(child);
+
+            /* Same as SSXMLElement::append() without releasing the memory of
+             * the parent's text, that will be reused. */
+            child->parentElement = current;
+            current->m_nodes.append(child);
+            current->addName(child);
+            current->m_text.resize(0);
+
+            current = child;
+            depth++;
+            break;
+        case QXmlStreamReader::EndElement:
+            current = current->parentElement;
+            depth--;
+            break;
+        case QXmlStreamReader::Characters:
+            if (current->m_nodes.isEmpty())
+            {
+                current->m_text.resize(0);
+                current->m_text.append(m_reader.text());
+            }
+            break;
+        case QXmlStreamReader::EndDocument:
+        case QXmlStreamReader::Invalid:
+            setError();
+            recycle(record);
+            return NULL;
+        default:
+            break;
+        }
+    }
+    return record;
+}
+/*}}}*/
+// SSXMLElement* SSXMLRecordReader::acquire();/*{{{*/
+/**
+ * Gets an empty element.
+ * @returns An element from the pool of elements to reuse. A new element
+ * when the pool is empty.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLElement* SSXMLRecordReader::acquire()
+{
+    if (m_pool.isEmpty())
+        return new SSXMLElement();
+
+    SSXMLElement *element = m_pool.last();
+    m_pool.removeLast();
+    return element;
+}
+/*}}}*/
+// void SSXMLRecordReader::fill(SSXMLElement *element);/*{{{*/
+/**
+ * Copies the name and attributes of the current element of the reader.
+ * @param element The element to fill. Must be empty.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLRecordReader::fill(SSXMLElement *element)
+{
+    QXmlStreamAttributes attributes = m_reader.attributes();
+    size_t limit = attributes.count();
+
+    element->elementName.append(m_reader.name());
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        const QXmlStreamAttribute &attribute = attributes.at(i);
+        element->m_attrs.insert(attribute.name().toString(), attribute.value().toString());
+    }
+}
+/*}}}*/
+// void SSXMLRecordReader::recycle(SSXMLElement *element);/*{{{*/
+/**
+ * Puts an element and its whole subtree in the pool of elements to reuse.
+ * @param element The element. Can be \b NULL.
+ * @remarks Names, texts and lists of children are emptied keeping their
+ * allocated memory.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLRecordReader::recycle(SSXMLElement *element)
+{
+    if (!element) return;
+
+    /* The pool itself is used as the list of elements to visit. */
+    int index = m_pool.count();
+    SSXMLElement *node;
+
+    m_pool.append(element);
+    for (; index < m_pool.count(); ++index)
+    {
+        node = m_pool.at(index);
+
+        if (!node->m_nodes.isEmpty())
+        {
+            m_pool << node->m_nodes.toVector();
+            node->m_nodes.erase(node->m_nodes.begin(), node->m_nodes.end());
+            node->dropNames();
+        }
+        node->m_attrs.clear();
+        node->elementName.resize(0);
+        node->m_text.resize(0);
+        node->parentElement = NULL;
+    }
+}
+/*}}}*/
+// void SSXMLRecordReader::setError();/*{{{*/
+/**
+ * Sets the error code from the state of the reader.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLRecordReader::setError()
+{
+    if (!m_reader.hasError())
+    {
+        m_error = SSE_IO;           /* Document ended before the root. */
+        return;
+    }
+
+    sstrace("%s\n", SST(m_reader.errorString()));
+    ssprint("=> at line: %d, column: %d", (int)m_reader.lineNumber(), (int)m_reader.columnNumber());
+
+    switch (m_reader.error())
+    {
+    case QXmlStreamReader::NotWellFormedError:
+    case QXmlStreamReader::UnexpectedElementError:
+        m_error = SSE_FTYPE;
+        break;
+    case QXmlStreamReader::PrematureEndOfDocumentError:
+        m_error = SSE_IO;
+        break;
+    default:
+        m_error = SSE_FAULT;
+        break;
+    }
+}
+/*}}}*/
+///@} Implementation
+
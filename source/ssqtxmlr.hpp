@@ -0,0 +1,216 @@
+/**
+ * \file
+ * Declares the SSXMLRecordReader class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLR_HPP_DEFINED__
+#define __SSQTXMLR_HPP_DEFINED__
+
+#include <QString>
+#include <QVector>
+#include <QIODevice>
+#include <QXmlStreamReader>
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtxmle.hpp"
+
+/**
+ * @ingroup ssqt_xml
+ * Reads a document one record at a time.
+ * A record is a child of the root element. Files shaped like a long list of
+ * records, as <tt>&lt;log&gt;&lt;entry/&gt;...&lt;/log&gt;</tt>, can be
+ * processed with memory bounded by the largest record instead of the whole
+ * file.
+ *
+ * Each call to #next() builds the next record as a standalone \c
+ * SSXMLElement. The record is owned by the reader and is recycled in the next
+ * call. Its element objects, and the memory of their names, texts and lists of
+ * children, are reused by the following records. After the first records
+ * are read, new elements are allocated only when a record is larger than all
+ * the previous ones. A record that must be kept can be taken with
+ * #takeRecord().
+ * ~~~~~~~~~~~~~~{.cpp}
+ * QFile file("events.xml");
+ * file.open(QIODevice::ReadOnly);
+ *
+ * SSXMLRecordReader reader(&file);
+ * reader.recordName("entry");
+ *
+ * while (SSXMLElement *entry = reader.next())
+ *     process(entry);
+ *
+ * if (reader.error() != SSNO_ERROR)
+ *     reportError();
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLRecordReader
+{
+public:
+    // explicit SSXMLRecordReader(QIODevice *device = NULL);/*{{{*/
+    /**
+     * Builds a reader.
+     * @param device The device to read. Must be open for reading. Can be \b
+     * NULL and set later with #setDevice().
+     * @since 1.1
+     **/
+    explicit SSXMLRecordReader(QIODevice *device = NULL);
+    /*}}}*/
+    virtual ~SSXMLRecordReader();
+
+public:         // Attributes
+    // const SSXMLElement* rootElement() const;/*{{{*/
+    /**
+     * The root element of the document.
+     * @returns The root element with its name and attributes, but without
+     * children. Its name is empty until the first call to #next().
+     * @since 1.1
+     **/
+    const SSXMLElement* rootElement() const;
+    /*}}}*/
+    // SSXMLElement* record() const;/*{{{*/
+    /**
+     * The current record.
+     * @returns The record returned by the last call to #next() or \b NULL.
+     * @since 1.1
+     **/
+    SSXMLElement* record() const;
+    /*}}}*/
+    // QString recordName() const;/*{{{*/
+    /**
+     * Name of the elements read as records.
+     * @returns The name set with #recordName(const QString&). An empty
+     * string means that every child of the root element is a record.
+     * @since 1.1
+     **/
+    QString recordName() const;
+    /*}}}*/
+    // void recordName(const QString &name);/*{{{*/
+    /**
+     * Selects the elements read as records.
+     * @param name Name of the records. Children of the root element with
+     * other names are skipped without being built. An empty string reads
+     * every child of the root element.
+     * @since 1.1
+     **/
+    void recordName(const QString &name);
+    /*}}}*/
+    // error_t error() const;/*{{{*/
+    /**
+     * The result of the last read.
+     * @return \b 0 (\c SSNO_ERROR) when there is no error. Otherwise an error
+     * code with the same meaning of the ones returned by
+     * SSXMLDocument::open().
+     * @since 1.1
+     **/
+    error_t error() const;
+    /*}}}*/
+    // bool atEnd() const;/*{{{*/
+    /**
+     * Checks whether the end of the root element was reached.
+     * @since 1.1
+     **/
+    bool atEnd() const;
+    /*}}}*/
+
+public:         // Operations
+    // void setDevice(QIODevice *device);/*{{{*/
+    /**
+     * Restarts reading from another device.
+     * @param device The device to read. Must be open for reading.
+     * @remarks The current record is recycled. Elements already allocated
+     * are kept for the new device.
+     * @since 1.1
+     **/
+    void setDevice(QIODevice *device);
+    /*}}}*/
+    // SSXMLElement* next();/*{{{*/
+    /**
+     * Reads the next record.
+     * @returns The next record or \b NULL when there are no more records or
+     * when an error happens. Use #error() to tell the cases apart.
+     * @remarks The record returned by the previous call is recycled and must
+     * not be used any more.
+     * @since 1.1
+     **/
+    SSXMLElement* next();
+    /*}}}*/
+    // SSXMLElement* takeRecord();/*{{{*/
+    /**
+     * Takes the ownership of the current record.
+     * @returns The current record or \b NULL when there is none. The caller
+     * must delete the element when it is no longer needed. The reader will not
+     * recycle it.
+     * @since 1.1
+     **/
+    SSXMLElement* takeRecord();
+    /*}}}*/
+
+protected:      // Implementation
+    SSXMLElement* build();
+    SSXMLElement* acquire();
+    void fill(SSXMLElement *element);
+    void recycle(SSXMLElement *element);
+    void setError();
+
+protected:      // Data Members
+    QXmlStreamReader m_reader;          /**< The XML reader.                */
+    SSXMLElement  m_root;               /**< Root element without children. */
+    SSXMLElement *m_record;             /**< Current record.                */
+    QVector<SSXMLElement*> m_pool;      /**< Elements ready to be reused.   */
+    QString m_recordName;               /**< Name of records or empty.      */
+    error_t m_error;                    /**< Result of the last read.       */
+    bool    m_started;                  /**< Root element was read.         */
+    bool    m_finished;                 /**< Root element was closed.       */
+
+private:
+    Q_DISABLE_COPY(SSXMLRecordReader)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLRecordReader *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline const SSXMLElement* SSXMLRecordReader::rootElement() const;/*{{{*/
+inline const SSXMLElement* SSXMLRecordReader::rootElement() const {
+    return &m_root;
+}
+/*}}}*/
+// inline SSXMLElement* SSXMLRecordReader::record() const;/*{{{*/
+inline SSXMLElement* SSXMLRecordReader::record() const {
+    return m_record;
+}
+/*}}}*/
+// inline QString SSXMLRecordReader::recordName() const;/*{{{*/
+inline QString SSXMLRecordReader::recordName() const {
+    return m_recordName;
+}
+/*}}}*/
+// inline void SSXMLRecordReader::recordName(const QString &name);/*{{{*/
+inline void SSXMLRecordReader::recordName(const QString &name) {
+    m_recordName = name;
+}
+/*}}}*/
+// inline error_t SSXMLRecordReader::error() const;/*{{{*/
+inline error_t SSXMLRecordReader::error() const {
+    return m_error;
+}
+/*}}}*/
+// inline bool SSXMLRecordReader::atEnd() const;/*{{{*/
+inline bool SSXMLRecordReader::atEnd() const {
+    return m_finished;
+}
+/*}}}*/
+///@} SSXMLRecordReader /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLR_HPP_DEFINED__ */
@@ -0,0 +1,190 @@
+/**
+ * \file
+ * Defines the SSXMLPublisher class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlc.hpp"
+#include "ssqtxmls.hpp"
+
+/* ===========================================================================
+ * SSXMLPublisher class
+ *
+ * Readers register themselves in one of two counters, selected by the parity
+ * of the current epoch. A retired snapshot can be released when every reader
+ * that could have seen it has left. The writer flips the epoch, so new
+ * readers use the other counter, and waits the counter of the old epoch to
+ * drop to zero. Readers check the epoch again after incrementing the counter
+ * so a reader delayed across a flip retries in the new counter instead of
+ * increasing a counter that is being drained.
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLPublisher::SSXMLPublisher();/*{{{*/
+/**
+ * Default constructor.
+ * Builds a publisher without a current snapshot.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLPublisher::SSXMLPublisher() : m_epoch(0), m_current(NULL), m_waitSlot(0)
+{
+    m_readers[0].store(0);
+    m_readers[1].store(0);
+}
+/*}}}*/
+// SSXMLPublisher::~SSXMLPublisher();/*{{{*/
+/**
+ * Destructor.
+ * Retires the current snapshot and waits for it and all other retired
+ * snapshots to be released.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLPublisher::~SSXMLPublisher()
+{
+    /* Readers may still be using the current snapshot. It goes through the
+     * grace period like any other. */
+    m_mutex.lock();
+
+    SSXMLCompactDocument *current = m_current.fetchAndStoreOrdered(NULL);
+    if (current)
+        m_retired.append(current);
+
+    m_mutex.unlock();
+
+    synchronize();
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLPublisher::publish(SSXMLCompactDocument *document);/*{{{*/
+error_t SSXMLPublisher::publish(SSXMLCompactDocument *document)
+{
+    if (document && (document->storage() == SSXML_STORE_LAZY))
+        return SSE_INVAL;
+
+    m_mutex.lock();
+
+    SSXMLCompactDocument *previous = m_current.fetchAndStoreOrdered(document);
+    if (previous)
+        m_retired.append(previous);
+
+    m_mutex.unlock();
+
+    reclaim();
+    return SSNO_ERROR;
+}
+/*}}}*/
+// error_t SSXMLPublisher::publish(const SSXMLElement *root);/*{{{*/
+error_t SSXMLPublisher::publish(const SSXMLElement *root)
+{
+    SSXMLCompactDocument *document = new SSXMLCompactDocument();
+    error_t result = document->assign(root);
+
+    if (result != SSNO_ERROR)
+    {
+        delete document;
+        return result;
+    }
+    return publish(document);
+}
+/*}}}*/
+// size_t SSXMLPublisher::reclaim();/*{{{*/
+size_t SSXMLPublisher::reclaim()
+{
+    QMutexLocker locker(&m_mutex);
+    size_t released = 0;
+
+    /* Starts a new grace period when there is none running. Snapshots
+     * retired until now are released when it ends. */
+    if (m_waiting.isEmpty() && !m_retired.isEmpty())
+    {
+        m_waiting  = m_retired;
+        m_retired.clear();
+        m_waitSlot = (m_epoch.fetchAndAddOrdered(1) & 1);
+    }
+
+    if (!m_waiting.isEmpty() && (m_readers[m_waitSlot].loadAcquire() == 0))
+    {
+        released = m_waiting.count();
+        qDeleteAll(m_waiting);
+        m_waiting.clear();
+    }
+    return released;
+}
+/*}}}*/
+// void SSXMLPublisher::synchronize();/*{{{*/
+void SSXMLPublisher::synchronize()
+{
+    forever
+    {
+        reclaim();
+
+        m_mutex.lock();
+        bool done = (m_waiting.isEmpty() && m_retired.isEmpty());
+        m_mutex.unlock();
+
+        if (done) break;
+        QThread::yieldCurrentThread();
+    }
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// int  SSXMLPublisher::readLock() const;/*{{{*/
+/**
+ * Registers a reader in the current epoch.
+ * @returns The slot where the reader was registered. Must be passed to
+ * #readUnlock().
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+int SSXMLPublisher::readLock() const
+{
+    int slot;
+
+    forever
+    {
+        slot = (m_epoch.loadAcquire() & 1);
+        m_readers[slot].ref();
+
+        if ((m_epoch.loadAcquire() & 1) == slot)
+            break;
+
+        /* The epoch was flipped while we were registering. */
+        m_readers[slot].deref();
+    }
+    return slot;
+}
+/*}}}*/
+// void SSXMLPublisher::readUnlock(int slot) const;/*{{{*/
+/**
+ * Unregisters a reader.
+ * @param slot Value returned by #readLock().
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLPublisher::readUnlock(int slot) const
+{
+    m_readers[slot].deref();
+}
+/*}}}*/
+///@} Implementation
@@ -0,0 +1,219 @@
+/**
+ * \file
+ * Declares the SSXMLPublisher and SSXMLSnapshotLock classes.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLS_HPP_DEFINED__
+#define __SSQTXMLS_HPP_DEFINED__
+
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QMutex>
+#include <QList>
+#include "ssqtcmn.hpp"
+#include "ssqtxmlc.hpp"
+
+/**
+ * @ingroup ssqt_xml
+ * Publishes immutable document snapshots to concurrent readers.
+ * A publisher holds the current version of a document in its compact, read
+ * only, form (\c SSXMLCompactDocument). Any number of threads can read the
+ * current snapshot at the same time without locks, using \c
+ * SSXMLSnapshotLock objects. Readers never block, not even when a new
+ * snapshot is being published.
+ *
+ * Publishing a new snapshot is an atomic pointer swap. The replaced snapshot
+ * is not released immediately since readers can still be using it. It is
+ * retired and only released after a <em>grace period</em>, that is, after
+ * every reader that could have seen it has finished. This is the same scheme
+ * used by RCU (read-copy-update). Retired snapshots are released by
+ * #reclaim(), that is called by #publish() and never waits, or by
+ * #synchronize(), that waits until all retired snapshots are released.
+ *
+ * Only one thread should publish at a time. Concurrent calls to #publish()
+ * are serialized by an internal mutex that is never touched by readers.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * SSXMLPublisher config;               // Shared by all threads.
+ *
+ * // GUI thread:
+ * SSXMLDocument doc(":/config/#100");
+ * config.publish(&doc);
+ *
+ * // Worker threads:
+ * SSXMLSnapshotLock snapshot(config);
+ * int port = snapshot.documentElement().firstElement().intValueOf("port");
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLPublisher
+{
+public:
+    SSXMLPublisher();
+    virtual ~SSXMLPublisher();
+
+public:         // Operations
+    // error_t publish(SSXMLCompactDocument *document);/*{{{*/
+    /**
+     * Publishes a new snapshot.
+     * @param document The new snapshot. This publisher takes ownership of
+     * this object. It must not be changed after this call.
+     * @return \b 0 (\c SSNO_ERROR) on success. \c SSE_INVAL when \a
+     * document stores \c SSXML_STORE_LAZY. Lazy documents decode values in
+     * \c const functions and cannot be read by several threads. In this
+     * case the caller keeps the ownership of \a document.
+     * @remarks The previous snapshot, if any, is retired and will be
+     * released when no reader is using it. Readers that start after this
+     * function returns always see \a document.
+     * @since 1.1
+     **/
+    error_t publish(SSXMLCompactDocument *document);
+    /*}}}*/
+    // error_t publish(const SSXMLElement *root);/*{{{*/
+    /**
+     * Publishes a snapshot of an element tree.
+     * @param root The element tree to publish. A compact copy of it is built
+     * and published. The element can be changed or released after this call.
+     * @return \b 0 (\c SSNO_ERROR) on success. Otherwise an error code
+     * returned by SSXMLCompactDocument::assign(). In case of errors the
+     * current snapshot is not changed.
+     * @since 1.1
+     **/
+    error_t publish(const SSXMLElement *root);
+    /*}}}*/
+    // size_t reclaim();/*{{{*/
+    /**
+     * Releases retired snapshots that are no longer in use.
+     * @returns The number of snapshots released.
+     * @remarks This function never waits for readers. Snapshots that could
+     * still be in use are kept for a later call.
+     * @since 1.1
+     **/
+    size_t reclaim();
+    /*}}}*/
+    // void synchronize();/*{{{*/
+    /**
+     * Waits until all retired snapshots are released.
+     * @remarks The function waits until every reader using a retired
+     * snapshot finishes. Readers are not blocked while the function waits.
+     * Must not be called from a thread that holds a \c SSXMLSnapshotLock of
+     * this publisher.
+     * @since 1.1
+     **/
+    void synchronize();
+    /*}}}*/
+
+protected:      // Implementation
+    int  readLock() const;
+    void readUnlock(int slot) const;
+
+protected:      // Data Members
+    mutable QAtomicInt m_readers[2];    /**< Active readers in each epoch.  */
+    QAtomicInt m_epoch;                 /**< Current reading epoch.         */
+    QAtomicPointer<SSXMLCompactDocument> m_current; /**< Current snapshot.  */
+    QList<SSXMLCompactDocument*> m_retired; /**< Waiting a grace period.    */
+    QList<SSXMLCompactDocument*> m_waiting; /**< In the grace period.       */
+    int    m_waitSlot;                  /**< Epoch slot being drained.      */
+    QMutex m_mutex;                     /**< Serializes writers.            */
+
+    friend class SSXMLSnapshotLock;
+
+private:
+    Q_DISABLE_COPY(SSXMLPublisher)
+};
+
+/**
+ * @ingroup ssqt_xml
+ * Read access to the current snapshot of a \c SSXMLPublisher.
+ * Objects of this class are meant to be created in the stack. While the
+ * object lives the snapshot it references is guaranteed to be valid, even if
+ * a new snapshot is published by another thread. Building and destroying
+ * these objects never blocks and doesn't allocate memory.
+ * @note Keep the object alive only while the snapshot is being read. Retired
+ * snapshots cannot be released while there are readers that could be using
+ * them.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLSnapshotLock
+{
+public:
+    explicit SSXMLSnapshotLock(const SSXMLPublisher &publisher);
+    ~SSXMLSnapshotLock();
+
+public:         // Attributes
+    // const SSXMLCompactDocument* document() const;/*{{{*/
+    /**
+     * The snapshot being read.
+     * @returns A pointer to the snapshot or \b NULL when nothing was
+     * published yet.
+     * @since 1.1
+     **/
+    const SSXMLCompactDocument* document() const;
+    /*}}}*/
+    // SSXMLCompactElement documentElement() const;/*{{{*/
+    /**
+     * Root element of the snapshot.
+     * @returns The root element or a \e null element when nothing was
+     * published yet.
+     * @since 1.1
+     **/
+    SSXMLCompactElement documentElement() const;
+    /*}}}*/
+
+private:
+    const SSXMLPublisher *m_publisher;  /**< Publisher of the snapshot.     */
+    const SSXMLCompactDocument *m_document; /**< The locked snapshot.       */
+    int m_slot;                         /**< Epoch slot of this reader.     */
+
+    Q_DISABLE_COPY(SSXMLSnapshotLock)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLSnapshotLock *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLSnapshotLock::SSXMLSnapshotLock(const SSXMLPublisher &publisher);/*{{{*/
+/**
+ * Starts reading the current snapshot of a publisher.
+ * @param publisher The publisher with the snapshot to read.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLSnapshotLock::SSXMLSnapshotLock(const SSXMLPublisher &publisher) :
+    m_publisher(&publisher) {
+    m_slot     = publisher.readLock();
+    m_document = publisher.m_current.loadAcquire();
+}
+/*}}}*/
+// inline SSXMLSnapshotLock::~SSXMLSnapshotLock();/*{{{*/
+/**
+ * Destructor.
+ * Ends reading the snapshot.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLSnapshotLock::~SSXMLSnapshotLock() {
+    m_publisher->readUnlock(m_slot);
+}
+/*}}}*/
+// inline const SSXMLCompactDocument* SSXMLSnapshotLock::document() const;/*{{{*/
+inline const SSXMLCompactDocument* SSXMLSnapshotLock::document() const {
+    return m_document;
+}
+/*}}}*/
+// inline SSXMLCompactElement SSXMLSnapshotLock::documentElement() const;/*{{{*/
+inline SSXMLCompactElement SSXMLSnapshotLock::documentElement() const {
+    if (!m_document) return SSXMLCompactElement();
+    return m_document->documentElement();
+}
+/*}}}*/
+///@} SSXMLSnapshotLock /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLS_HPP_DEFINED__ */
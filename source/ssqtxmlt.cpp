@@ -0,0 +1,258 @@
+/**
+ * \file
+ * Defines the SSXMLTransform class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtgzip.hpp"
+#include "ssqtxmlw.hpp"
+#include "ssqtxmlt.hpp"
+
+/* ===========================================================================
+ * SSXMLTransform class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLTransform::SSXMLTransform(uint width = 0);/*{{{*/
+SSXMLTransform::SSXMLTransform(uint width) : m_width(width)
+{
+}
+/*}}}*/
+// SSXMLTransform::~SSXMLTransform();/*{{{*/
+/**
+ * Destructor.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLTransform::~SSXMLTransform()
+{
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// error_t SSXMLTransform::run(QIODevice *input, QIODevice *output);/*{{{*/
+error_t SSXMLTransform::run(QIODevice *input, QIODevice *output)
+{
+    if (!input || !output) return SSE_INVAL;
+
+    QXmlStreamReader reader(input);
+    SSXMLWriter writer(output, m_width);
+    QXmlStreamAttributes attributes;
+    QString name, value;
+    size_t limit;
+
+    m_path.clear();
+    m_written.clear();
+    m_namespaces.clear();
+
+    writer.startDocument();
+
+    while (!reader.atEnd() && (writer.error() == SSNO_ERROR))
+    {
+        switch (reader.readNext())
+        {
+        case QXmlStreamReader::StartElement:
+            name       = reader.qualifiedName().toString();
+            attributes = reader.attributes();
+            m_path.append(name);
+            m_namespaces.append(reader.namespaceDeclarations());
+
+            switch (element(name, attributes))
+            {
+            case SSXML_SKIP:
+                reader.skipCurrentElement();
+                m_path.removeLast();
+                m_namespaces.removeLast();
+                break;
+            case SSXML_UNWRAP:
+                m_written.append(false);
+                break;
+            default:
+                writer.startElement(name);
+                writeNamespaces(&writer);
+
+                limit = attributes.count();
+                for (size_t i = 0; i < limit; ++i)
+                    writer.attribute(attributes.at(i).qualifiedName().toString(), attributes.at(i).value().toString());
+
+                m_written.append(true);
+                break;
+            }
+            break;
+        case QXmlStreamReader::EndElement:
+            if (m_written.last()) writer.endElement();
+
+            m_written.removeLast();
+            m_path.removeLast();
+            m_namespaces.removeLast();
+            break;
+        case QXmlStreamReader::Characters:
+            if (m_path.isEmpty() || ((m_width > 0) && reader.isWhitespace()))
+                break;
+
+            value = reader.text().toString();
+            text(value);
+            writer.text(value);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (reader.hasError())
+    {
+        sstrace("%s\n", SST(reader.errorString()));
+        ssprint("=> at line: %d, column: %d", (int)reader.lineNumber(), (int)reader.columnNumber());
+
+        switch (reader.error())
+        {
+        case QXmlStreamReader::NotWellFormedError:
+        case QXmlStreamReader::UnexpectedElementError:
+            return SSE_FTYPE;
+        case QXmlStreamReader::PrematureEndOfDocumentError:
+            return SSE_IO;
+        default:
+            return SSE_FAULT;
+        }
+    }
+    return writer.endDocument();
+}
+/*}}}*/
+// error_t SSXMLTransform::run(const QString &input, const QString &output);/*{{{*/
+error_t SSXMLTransform::run(const QString &input, const QString &output)
+{
+    QFile source(input);
+    QFile target(output);
+
+    if (!source.open(QIODevice::ReadOnly))
+    {
+        sstrace("Error: '%s'", SST(source.errorString()));
+        return SSE_IO;
+    }
+
+    if (!target.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        sstrace("Error: '%s'", SST(target.errorString()));
+        source.close();
+        return SSE_IO;
+    }
+
+    SSGZipDevice unzip(&source);
+    SSGZipDevice zip(&target);
+    QIODevice *reading = &source;
+    QIODevice *writing = &target;
+    error_t result = SSNO_ERROR;
+
+    if (SSGZipDevice::isCompressed(&source))
+    {
+        if (unzip.open(QIODevice::ReadOnly))
+            reading = &unzip;
+        else
+            result = SSE_IO;
+    }
+
+    if ((result == SSNO_ERROR) && output.endsWith(SSGZIP_SUFFIX, Qt::CaseInsensitive))
+    {
+        if (zip.open(QIODevice::WriteOnly))
+            writing = &zip;
+        else
+            result = SSE_IO;
+    }
+
+    if (result == SSNO_ERROR)
+        result = run(reading, writing);
+
+    /* The compressed output is complete only with its end. */
+    if (zip.isOpen())
+    {
+        if (!zip.finish() && (result == SSNO_ERROR))
+        {
+            sstrace("Error: '%s'", SST(zip.errorString()));
+            result = SSE_IO;
+        }
+        zip.close();
+    }
+    if (unzip.isOpen()) unzip.close();
+
+    source.close();
+    target.close();
+
+    return result;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Overridables */ //@{
+/* ------------------------------------------------------------------------ */
+// uint SSXMLTransform::element(QString &name, QXmlStreamAttributes &attributes);/*{{{*/
+uint SSXMLTransform::element(QString &name, QXmlStreamAttributes &attributes)
+{
+    Q_UNUSED(name);
+    Q_UNUSED(attributes);
+    return SSXML_KEEP;
+}
+/*}}}*/
+// void SSXMLTransform::text(QString &text);/*{{{*/
+void SSXMLTransform::text(QString &text)
+{
+    Q_UNUSED(text);
+}
+/*}}}*/
+///@} Overridables
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLTransform::writeNamespaces(SSXMLWriter *writer);/*{{{*/
+/**
+ * Writes the namespace declarations of the element being started.
+ * Declarations of unwrapped parents, up to the closest parent written, are
+ * written too, so the output keeps them in scope.
+ * @param writer The writer, just after the start tag.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLTransform::writeNamespaces(SSXMLWriter *writer)
+{
+    size_t first = m_namespaces.count() - 1;
+
+    while ((first > 0) && !m_written.at(first - 1))
+        first--;
+
+    size_t limit = m_namespaces.count();
+    for (size_t i = first; i < limit; ++i)
+    {
+        const QXmlStreamNamespaceDeclarations &list = m_namespaces.at(i);
+        size_t count = list.count();
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            const QXmlStreamNamespaceDeclaration &decl = list.at(j);
+
+            if (decl.prefix().isEmpty())
+                writer->attribute(QLatin1String("xmlns"), decl.namespaceUri().toString());
+            else
+                writer->attribute(QLatin1String("xmlns:") + decl.prefix().toString(), decl.namespaceUri().toString());
+        }
+    }
+}
+/*}}}*/
+///@} Implementation
+
@@ -0,0 +1,190 @@
+/**
+ * \file
+ * Declares the SSXMLTransform class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLT_HPP_DEFINED__
+#define __SSQTXMLT_HPP_DEFINED__
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QIODevice>
+#include <QXmlStreamAttributes>
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+
+/**
+ * @internal
+ * Forward declarations.
+ * @{ *//* ---------------------------------------------------------------- */
+class SSXMLWriter;
+///@} internal
+
+/**
+ * \ingroup ssqt_xml
+ * Actions returned by SSXMLTransform::element().
+ * @{ *//* ---------------------------------------------------------------- */
+#define SSXML_KEEP          0       /**< Writes the element.                */
+#define SSXML_SKIP          1       /**< Drops the element and its content. */
+#define SSXML_UNWRAP        2       /**< Drops the tags, keeps the content. */
+///@}
+
+/**
+ * @ingroup ssqt_xml
+ * Rewrites a document while it is read.
+ * The input is read with a \c QXmlStreamReader and written with a
+ * SSXMLWriter. No element tree is built, so files larger than the available
+ * memory can be processed. Memory usage depends only on the nesting level of
+ * the document.
+ *
+ * The virtual function #element() is called for every start tag. It can
+ * change the element name and attributes, and decide whether the element is
+ * kept, dropped with all its content or replaced by its content. The virtual
+ * function #text() can change the text of elements. The default
+ * implementations copy the input unchanged.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * class RenameIds : public SSXMLTransform
+ * {
+ * protected:
+ *     uint element(QString &name, QXmlStreamAttributes &attributes) {
+ *         if (name == "debug") return SSXML_SKIP;
+ *
+ *         for (int i = 0; i < attributes.count(); ++i) {
+ *             if (attributes[i].name() == "id")
+ *                 attributes[i] = QXmlStreamAttribute("id", "x-" + attributes[i].value());
+ *         }
+ *         return SSXML_KEEP;
+ *     }
+ * };
+ *
+ * RenameIds transform;
+ * error_t result = transform.run("input.xml.gz", "output.xml.gz");
+ * ~~~~~~~~~~~~~~
+ * @remarks Names are qualified, with the prefix used in the input. Namespace
+ * declarations are written as \c xmlns attributes of the element that has
+ * them. When that element is unwrapped, they are written in each of its
+ * children that is kept. Comments, processing instructions and the document
+ * type declaration are not copied. When the indentation width is zero, the
+ * default, white space between elements is copied as is. Otherwise it is
+ * replaced by the writer's indentation.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLTransform
+{
+public:
+    // explicit SSXMLTransform(uint width = 0);/*{{{*/
+    /**
+     * Builds a transform.
+     * @param width Indentation width of the output. The same of
+     * SSXMLWriter::SSXMLWriter().
+     * @since 1.1
+     **/
+    explicit SSXMLTransform(uint width = 0);
+    /*}}}*/
+    virtual ~SSXMLTransform();
+
+public:         // Attributes
+    // const QStringList& path() const;/*{{{*/
+    /**
+     * Names of the input elements open at this moment.
+     * @returns The list starts with the root element. During a call to
+     * #element() or #text() the last item is the name of the current
+     * element, before any change made by #element().
+     * @since 1.1
+     **/
+    const QStringList& path() const;
+    /*}}}*/
+
+public:         // Operations
+    // error_t run(QIODevice *input, QIODevice *output);/*{{{*/
+    /**
+     * Transforms a document.
+     * @param input Device to read. Must be open for reading.
+     * @param output Device to write. Must be open for writing.
+     * @return One of the following values:
+     * - \b SSNO_ERROR: Success.
+     * - \b SSE_INVAL: \a input or \a output is \b NULL.
+     * - \b SSE_FTYPE: The input is not a well formed XML document.
+     * - \b SSE_IO: Reading or writing failed.
+     * - \b SSE_FAULT: Any other kind of error.
+     * .
+     * @since 1.1
+     **/
+    error_t run(QIODevice *input, QIODevice *output);
+    /*}}}*/
+    // error_t run(const QString &input, const QString &output);/*{{{*/
+    /**
+     * Transforms a file.
+     * @param input Name of the file to read. Compressed files are detected
+     * and decompressed while read.
+     * @param output Name of the file to write. When it ends with
+     * \c SSGZIP_SUFFIX the output is compressed.
+     * @return The same of #run(QIODevice*, QIODevice*). \c SSE_IO also when
+     * the end of the compressed output cannot be written.
+     * @since 1.1
+     **/
+    error_t run(const QString &input, const QString &output);
+    /*}}}*/
+
+protected:      // Overridables
+    // virtual uint element(QString &name, QXmlStreamAttributes &attributes);/*{{{*/
+    /**
+     * Called for each start tag of the input.
+     * @param name The qualified element name. Can be changed.
+     * @param attributes The element attributes, in the input order. Can be
+     * changed.
+     * @returns One of \c SSXML_KEEP, \c SSXML_SKIP or \c SSXML_UNWRAP. The
+     * default implementation returns \c SSXML_KEEP.
+     * @remarks Unwrapping the root element must leave a single element as
+     * the new root.
+     * @since 1.1
+     **/
+    virtual uint element(QString &name, QXmlStreamAttributes &attributes);
+    /*}}}*/
+    // virtual void text(QString &text);/*{{{*/
+    /**
+     * Called for each text inside the root element.
+     * @param text The text, without escaping. Can be changed. An empty text
+     * is not written.
+     * @remarks The default implementation does nothing.
+     * @since 1.1
+     **/
+    virtual void text(QString &text);
+    /*}}}*/
+
+protected:      // Implementation
+    void writeNamespaces(SSXMLWriter *writer);
+
+protected:      // Data Members
+    QStringList   m_path;               /**< Open input elements.           */
+    QVector<bool> m_written;            /**< Open elements kept in output.  */
+    QVector<QXmlStreamNamespaceDeclarations> m_namespaces; /**< Declarations of open elements. */
+    uint m_width;                       /**< Indentation width.             */
+
+private:
+    Q_DISABLE_COPY(SSXMLTransform)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLTransform *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline const QStringList& SSXMLTransform::path() const;/*{{{*/
+inline const QStringList& SSXMLTransform::path() const {
+    return m_path;
+}
+/*}}}*/
+///@} SSXMLTransform /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLT_HPP_DEFINED__ */
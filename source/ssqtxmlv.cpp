@@ -0,0 +1,590 @@
+/**
+ * \file
+ * Defines the SSXMLVersion class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlj.hpp"
+#include "ssqtxmlv.hpp"
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static SSXMLVersionNode* __xml_buildNode(const SSXMLElement *element);/*{{{*/
+/**
+ * Copies an element tree to persistent nodes.
+ * @param element The root of the tree.
+ * @returns The new node, not shared yet.
+ * @since 1.1
+ **/
+static SSXMLVersionNode* __xml_buildNode(const SSXMLElement *element);
+/*}}}*/
+// static void __xml_extractNode(const SSXMLVersionNode *node, SSXMLElement *element);/*{{{*/
+/**
+ * Copies persistent nodes to an element tree.
+ * @param node The root of the persistent tree.
+ * @param element The element that receives \a node. It must be empty.
+ * @since 1.1
+ **/
+static void __xml_extractNode(const SSXMLVersionNode *node, SSXMLElement *element);
+/*}}}*/
+// static void __xml_updateNode(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *element);/*{{{*/
+/**
+ * Changes an element tree from one persistent tree to another.
+ * Nodes shared by both persistent trees are skipped.
+ * @param node The persistent tree to copy.
+ * @param previous The persistent tree held by \a element.
+ * @param element The element to change.
+ * @since 1.1
+ **/
+static void __xml_updateNode(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *element);
+/*}}}*/
+// static void __xml_updateChild(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *parent, uint index);/*{{{*/
+/**
+ * Changes a child element from one persistent tree to another.
+ * A child with a different name is replaced, so the parent never holds a
+ * renamed child.
+ * @param node The persistent tree to copy.
+ * @param previous The persistent tree held by the child.
+ * @param parent The parent element.
+ * @param index Position of the child in \a parent.
+ * @since 1.1
+ **/
+static void __xml_updateChild(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *parent, uint index);
+/*}}}*/
+// static void __xml_collectNodes(const SSXMLVersionNode *node, QSet<const SSXMLVersionNode*> *nodes);/*{{{*/
+/**
+ * Collects the nodes of a persistent tree.
+ * @param node The root of the tree.
+ * @param nodes Receives all nodes of the tree.
+ * @since 1.1
+ **/
+static void __xml_collectNodes(const SSXMLVersionNode *node, QSet<const SSXMLVersionNode*> *nodes);
+/*}}}*/
+// static size_t __xml_countShared(const SSXMLVersionNode *node, const QSet<const SSXMLVersionNode*> &nodes);/*{{{*/
+/**
+ * Counts the nodes of a persistent tree found in a set.
+ * @param node The root of the tree.
+ * @param nodes The set of nodes.
+ * @returns The number of nodes of the tree in \a nodes.
+ * @since 1.1
+ **/
+static size_t __xml_countShared(const SSXMLVersionNode *node, const QSet<const SSXMLVersionNode*> &nodes);
+/*}}}*/
+
+/* ===========================================================================
+ * SSXMLVersionChildren class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLVersionChildren::Pointer& SSXMLVersionChildren::edit(uint index);/*{{{*/
+SSXMLVersionChildren::Pointer& SSXMLVersionChildren::edit(uint index)
+{
+    /* Copies the list of blocks and the block of the child, when shared. */
+    Block &block = m_blocks[index / SSXML_VERSION_BLOCK];
+
+    block.detach();
+    return block->nodes[index % SSXML_VERSION_BLOCK];
+}
+/*}}}*/
+// void SSXMLVersionChildren::reserve(uint count);/*{{{*/
+void SSXMLVersionChildren::reserve(uint count)
+{
+    m_blocks.reserve((int)((count + SSXML_VERSION_BLOCK - 1) / SSXML_VERSION_BLOCK));
+}
+/*}}}*/
+// void SSXMLVersionChildren::append(const Pointer &node);/*{{{*/
+void SSXMLVersionChildren::append(const Pointer &node)
+{
+    if ((m_count % SSXML_VERSION_BLOCK) == 0)
+    {
+        m_blocks.append(Block(new SSXMLVersionBlock));
+        m_blocks.last()->nodes.reserve(SSXML_VERSION_BLOCK);
+    }
+
+    Block &block = m_blocks.last();
+
+    block.detach();
+    block->nodes.append(node);
+    m_count++;
+}
+/*}}}*/
+// void SSXMLVersionChildren::insert(uint index, const Pointer &node);/*{{{*/
+void SSXMLVersionChildren::insert(uint index, const Pointer &node)
+{
+    if (index >= m_count)
+    {
+        append(node);
+        return;
+    }
+
+    uint first = index / SSXML_VERSION_BLOCK;
+    QVector<Pointer> tail;
+
+    tail.reserve((int)(m_count - (first * SSXML_VERSION_BLOCK)) + 1);
+    for (uint i = first * SSXML_VERSION_BLOCK; i < m_count; ++i)
+    {
+        if (i == index) tail.append(node);
+        tail.append(at(i));
+    }
+    reflow(first, tail);
+}
+/*}}}*/
+// void SSXMLVersionChildren::remove(uint index);/*{{{*/
+void SSXMLVersionChildren::remove(uint index)
+{
+    if (index >= m_count) return;
+
+    uint first = index / SSXML_VERSION_BLOCK;
+    QVector<Pointer> tail;
+
+    tail.reserve((int)(m_count - (first * SSXML_VERSION_BLOCK)));
+    for (uint i = first * SSXML_VERSION_BLOCK; i < m_count; ++i)
+    {
+        if (i != index) tail.append(at(i));
+    }
+    reflow(first, tail);
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLVersionChildren::reflow(uint first, QVector<Pointer> &tail);/*{{{*/
+/**
+ * Replaces the last blocks of children.
+ * The blocks before \a first are kept, and stay shared with other versions.
+ * @param first Index of the first block replaced.
+ * @param tail The children that go in the new blocks, in order.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLVersionChildren::reflow(uint first, QVector<Pointer> &tail)
+{
+    size_t limit = tail.count();
+
+    m_blocks.resize((int)first);
+    m_count = first * SSXML_VERSION_BLOCK;
+
+    for (size_t i = 0; i < limit; ++i)
+        append(tail.at((int)i));
+}
+/*}}}*/
+///@} Implementation
+
+/* ===========================================================================
+ * SSXMLVersion class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Attributes */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLVersionElement SSXMLVersion::element(const QVector<int> &path) const;/*{{{*/
+SSXMLVersionElement SSXMLVersion::element(const QVector<int> &path) const
+{
+    SSXMLVersionElement node(m_root);
+    size_t limit = path.count();
+
+    for (size_t i = 0; (i < limit) && !node.isNull(); ++i)
+        node = node.elementAt((uint)path.at(i));
+
+    return node;
+}
+/*}}}*/
+// size_t SSXMLVersion::sharedWith(const SSXMLVersion &other) const;/*{{{*/
+size_t SSXMLVersion::sharedWith(const SSXMLVersion &other) const
+{
+    if (!m_root || !other.m_root) return 0;
+
+    QSet<const SSXMLVersionNode*> nodes;
+
+    __xml_collectNodes(other.m_root.constData(), &nodes);
+    return __xml_countShared(m_root.constData(), nodes);
+}
+/*}}}*/
+///@} Attributes
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLVersion::assign(const SSXMLElement *root);/*{{{*/
+void SSXMLVersion::assign(const SSXMLElement *root)
+{
+    if (root == NULL)
+        m_root.reset();
+    else
+        m_root = SSXMLVersionNode::Pointer(__xml_buildNode(root));
+}
+/*}}}*/
+// void SSXMLVersion::extract(SSXMLElement *root) const;/*{{{*/
+void SSXMLVersion::extract(SSXMLElement *root) const
+{
+    if (root == NULL) return;
+
+    root->removeAllAttributes();
+    root->removeAllElements();
+    root->text(QString());
+
+    if (!m_root)
+        root->elementName.clear();
+    else
+        __xml_extractNode(m_root.constData(), root);
+}
+/*}}}*/
+// void SSXMLVersion::extract(SSXMLElement *root, const SSXMLVersion &current) const;/*{{{*/
+void SSXMLVersion::extract(SSXMLElement *root, const SSXMLVersion &current) const
+{
+    if (root == NULL) return;
+
+    if (!m_root || !current.m_root)
+        extract(root);
+    else
+        __xml_updateNode(m_root.constData(), current.m_root.constData(), root);
+}
+/*}}}*/
+// bool SSXMLVersion::apply(const SSXMLChange &change);/*{{{*/
+bool SSXMLVersion::apply(const SSXMLChange &change)
+{
+    switch (change.type)
+    {
+    case SSXML_ATTRIBUTE_CHANGED:
+        return set(change.path, change.name, change.value);
+    case SSXML_ATTRIBUTE_REMOVED:
+        return remove(change.path, change.name);
+    case SSXML_TEXT_CHANGED:
+        {
+            SSXMLVersionNode *node = edit(change.path);
+            if (node == NULL) return false;
+
+            node->text = change.value;
+            return true;
+        }
+    case SSXML_CHILD_ADDED:
+        {
+            const SSXMLElement *child = change.element->elementAt((uint)change.index);
+            return insert(change.path, (uint)change.index, child);
+        }
+    case SSXML_CHILD_REMOVED:
+        {
+            QVector<int> path(change.path);
+
+            path.append(change.index);
+            return remove(path);
+        }
+    }
+    return false;
+}
+/*}}}*/
+// bool SSXMLVersion::set(const QVector<int> &path, const QString &attrName, const QString &attrValue);/*{{{*/
+bool SSXMLVersion::set(const QVector<int> &path, const QString &attrName, const QString &attrValue)
+{
+    SSXMLVersionNode *node = edit(path);
+    if (node == NULL) return false;
+
+    node->attrs.insert(attrName, attrValue);
+    return true;
+}
+/*}}}*/
+// bool SSXMLVersion::remove(const QVector<int> &path, const QString &attrName);/*{{{*/
+bool SSXMLVersion::remove(const QVector<int> &path, const QString &attrName)
+{
+    SSXMLVersionElement target = element(path);
+    if (target.isNull()) return false;
+
+    /* Nothing is copied when there is nothing to remove. */
+    if (!target.has(attrName)) return true;
+
+    edit(path)->attrs.remove(attrName);
+    return true;
+}
+/*}}}*/
+// bool SSXMLVersion::rename(const QVector<int> &path, const QString &name);/*{{{*/
+bool SSXMLVersion::rename(const QVector<int> &path, const QString &name)
+{
+    SSXMLVersionNode *node = edit(path);
+    if (node == NULL) return false;
+
+    node->name = name;
+    return true;
+}
+/*}}}*/
+// bool SSXMLVersion::text(const QVector<int> &path, const QString &elementText);/*{{{*/
+bool SSXMLVersion::text(const QVector<int> &path, const QString &elementText)
+{
+    SSXMLVersionElement target = element(path);
+    if (target.isNull() || target.hasChildren()) return false;
+
+    edit(path)->text = elementText;
+    return true;
+}
+/*}}}*/
+// bool SSXMLVersion::insert(const QVector<int> &path, uint index, const SSXMLElement *element);/*{{{*/
+bool SSXMLVersion::insert(const QVector<int> &path, uint index, const SSXMLElement *element)
+{
+    if (element == NULL) return false;
+
+    SSXMLVersionNode::Pointer node(__xml_buildNode(element));
+    return insert(path, index, SSXMLVersionElement(node));
+}
+/*}}}*/
+// bool SSXMLVersion::insert(const QVector<int> &path, uint index, const SSXMLVersionElement &element);/*{{{*/
+bool SSXMLVersion::insert(const QVector<int> &path, uint index, const SSXMLVersionElement &element)
+{
+    if (element.isNull()) return false;
+
+    SSXMLVersionNode *parent = edit(path);
+    if (parent == NULL) return false;
+
+    if (index > (uint)parent->nodes.count())
+        index = parent->nodes.count();
+
+    parent->text.clear();           /* Children has priority over text. */
+    parent->nodes.insert(index, element.m_node);
+    return true;
+}
+/*}}}*/
+// bool SSXMLVersion::remove(const QVector<int> &path);/*{{{*/
+bool SSXMLVersion::remove(const QVector<int> &path)
+{
+    if (path.isEmpty() || element(path).isNull())
+        return false;
+
+    SSXMLVersionNode *parent = edit(path.mid(0, path.count() - 1));
+
+    parent->nodes.remove((uint)path.last());
+    return true;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLVersionNode* SSXMLVersion::edit(const QVector<int> &path);/*{{{*/
+/**
+ * Gets an element to change.
+ * The element and its ancestors shared with other versions are copied. The
+ * copies replace the originals in this version only.
+ * @param path Path of the element.
+ * @returns The element, not shared with any other version. \b NULL when \a
+ * path doesn't exist. In this case nothing is copied.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+SSXMLVersionNode* SSXMLVersion::edit(const QVector<int> &path)
+{
+    if (element(path).isNull())
+        return NULL;
+
+    m_root.detach();
+
+    SSXMLVersionNode *node = m_root.data();
+    size_t limit = path.count();
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        /* Copies the list of blocks and the block of the child only. */
+        SSXMLVersionNode::Pointer &child = node->nodes.edit((uint)path.at(i));
+
+        child.detach();
+        node = child.data();
+    }
+    return node;
+}
+/*}}}*/
+///@} Implementation
+
+// static SSXMLVersionNode* __xml_buildNode(const SSXMLElement *element);/*{{{*/
+static SSXMLVersionNode* __xml_buildNode(const SSXMLElement *element)
+{
+    SSXMLVersionNode *node = new SSXMLVersionNode;
+    size_t limit = element->numberOfChildren();
+
+    node->name  = element->elementName;
+    node->text  = element->text();
+    node->attrs = element->attributes();
+
+    node->nodes.reserve((uint)limit);
+    for (size_t i = 0; i < limit; ++i)
+        node->nodes.append(SSXMLVersionNode::Pointer(__xml_buildNode(element->elementAt(i))));
+
+    return node;
+}
+/*}}}*/
+// static void __xml_extractNode(const SSXMLVersionNode *node, SSXMLElement *element);/*{{{*/
+static void __xml_extractNode(const SSXMLVersionNode *node, SSXMLElement *element)
+{
+    QHash<QString, QString>::const_iterator it;
+
+    element->elementName = node->name;
+    element->reserveAttributes(node->attrs.count());
+
+    for (it = node->attrs.constBegin(); it != node->attrs.constEnd(); ++it)
+        element->set(it.key(), it.value());
+
+    size_t limit = node->nodes.count();
+    if (limit == 0)
+    {
+        element->text(node->text);
+        return;
+    }
+
+    element->reserveChildren((uint)limit);
+    for (size_t i = 0; i < limit; ++i)
+    {
+        SSXMLElement *child = new SSXMLElement(QString());
+
+        __xml_extractNode(node->nodes.at((uint)i).constData(), child);
+        element->append(child);
+    }
+}
+/*}}}*/
+// static void __xml_updateNode(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *element);/*{{{*/
+static void __xml_updateNode(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *element)
+{
+    if (node == previous) return;
+
+    if (element->elementName != node->name)
+        element->elementName = node->name;
+
+    /* QHash compares its shared data first. Unchanged attributes cost O(1). */
+    if (node->attrs != previous->attrs)
+    {
+        QHash<QString, QString>::const_iterator it;
+
+        for (it = previous->attrs.constBegin(); it != previous->attrs.constEnd(); ++it)
+        {
+            if (!node->attrs.contains(it.key()))
+                element->remove(it.key());
+        }
+
+        for (it = node->attrs.constBegin(); it != node->attrs.constEnd(); ++it)
+        {
+            const QString *value = element->find(it.key());
+            if ((value == NULL) || (*value != it.value()))
+                element->set(it.key(), it.value());
+        }
+    }
+
+    uint count  = (uint)node->nodes.count();
+    uint before = (uint)previous->nodes.count();
+
+    if ((uint)element->numberOfChildren() != before)
+    {
+        /* The element doesn't hold the previous version. Copy again. */
+        element->removeAllElements();
+        element->reserveChildren(count);
+
+        for (uint i = 0; i < count; ++i)
+        {
+            SSXMLElement *child = new SSXMLElement(QString());
+
+            __xml_extractNode(node->nodes.at(i).constData(), child);
+            element->append(child);
+        }
+    }
+    else if (count == before)
+    {
+        /* Blocks are positional, so a shared block holds the same children
+         * in both versions. */
+        size_t blocks = node->nodes.countBlocks();
+
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            if (node->nodes.block((uint)b) == previous->nodes.block((uint)b))
+                continue;
+
+            uint first = (uint)b * SSXML_VERSION_BLOCK;
+            uint limit = qMin(count, first + SSXML_VERSION_BLOCK);
+
+            for (uint i = first; i < limit; ++i)
+                __xml_updateChild(node->nodes.at(i).constData(), previous->nodes.at(i).constData(), element, i);
+        }
+    }
+    else
+    {
+        /* Children were inserted or removed. Skip the common head and tail,
+         * then replace what is between them. */
+        uint least = qMin(count, before);
+        uint head  = 0, tail = 0;
+
+        while ((head < least) && (node->nodes.at(head) == previous->nodes.at(head)))
+            head++;
+
+        while ((tail < (least - head)) && (node->nodes.at(count - tail - 1) == previous->nodes.at(before - tail - 1)))
+            tail++;
+
+        for (uint i = before - tail; i > head; --i)
+            element->remove(i - 1);
+
+        for (uint i = head; i < (count - tail); ++i)
+        {
+            SSXMLElement *child = new SSXMLElement(QString());
+
+            __xml_extractNode(node->nodes.at(i).constData(), child);
+            element->insert(i, child);
+        }
+    }
+
+    if ((count == 0) && (element->text() != node->text))
+        element->text(node->text);
+}
+/*}}}*/
+// static void __xml_updateChild(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *parent, uint index);/*{{{*/
+static void __xml_updateChild(const SSXMLVersionNode *node, const SSXMLVersionNode *previous, SSXMLElement *parent, uint index)
+{
+    if (node == previous) return;
+
+    SSXMLElement *element = parent->elementAt(index);
+
+    if (element->elementName == node->name)
+    {
+        __xml_updateNode(node, previous, element);
+        return;
+    }
+
+    /* Renaming in place would leave the name index of the parent stale. */
+    SSXMLElement *child = new SSXMLElement(QString());
+
+    __xml_extractNode(node, child);
+    parent->remove(index);
+    parent->insert(index, child);
+}
+/*}}}*/
+// static void __xml_collectNodes(const SSXMLVersionNode *node, QSet<const SSXMLVersionNode*> *nodes);/*{{{*/
+static void __xml_collectNodes(const SSXMLVersionNode *node, QSet<const SSXMLVersionNode*> *nodes)
+{
+    nodes->insert(node);
+
+    size_t limit = node->nodes.count();
+    for (size_t i = 0; i < limit; ++i)
+        __xml_collectNodes(node->nodes.at((uint)i).constData(), nodes);
+}
+/*}}}*/
+// static size_t __xml_countShared(const SSXMLVersionNode *node, const QSet<const SSXMLVersionNode*> &nodes);/*{{{*/
+static size_t __xml_countShared(const SSXMLVersionNode *node, const QSet<const SSXMLVersionNode*> &nodes)
+{
+    size_t count = (nodes.contains(node) ? 1 : 0);
+    size_t limit = node->nodes.count();
+
+    for (size_t i = 0; i < limit; ++i)
+        count += __xml_countShared(node->nodes.at((uint)i).constData(), nodes);
+
+    return count;
+}
+/*}}}*/
+
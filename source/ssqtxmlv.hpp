@@ -0,0 +1,657 @@
+/**
+ * \file
+ * Declares the SSXMLVersion and SSXMLVersionElement classes.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLV_HPP_DEFINED__
+#define __SSQTXMLV_HPP_DEFINED__
+
+#include <QString>
+#include <QVector>
+#include <QHash>
+#include <QSharedData>
+#include "ssqtcmn.hpp"
+
+/**
+ * @internal
+ * Forward declarations.
+ * @{ *//* ---------------------------------------------------------------- */
+class SSXMLElement;
+class SSXMLVersion;
+struct SSXMLChange;
+struct SSXMLVersionNode;
+///@} internal
+
+/**
+ * Number of children kept in each block of SSXMLVersionChildren.
+ * @since 1.1
+ **/
+#define SSXML_VERSION_BLOCK     64
+
+/**
+ * @internal
+ * A block of children of a persistent node.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+struct SSXMLVersionBlock : public QSharedData
+{
+    QVector<QExplicitlySharedDataPointer<SSXMLVersionNode> > nodes; /**< Children. */
+};
+
+/**
+ * @internal
+ * Children of a persistent node.
+ * The children are kept in shared blocks of \c SSXML_VERSION_BLOCK nodes.
+ * Replacing a child copies the list of blocks and the block of the child
+ * only, not the whole list of children. Inserting or removing a child copies
+ * the blocks from the position of the change up to the end.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLVersionChildren
+{
+public:
+    typedef QExplicitlySharedDataPointer<SSXMLVersionNode> Pointer;
+    typedef QExplicitlySharedDataPointer<SSXMLVersionBlock> Block;
+
+    SSXMLVersionChildren();
+
+public:         // Attributes
+    size_t count() const;
+    size_t countBlocks() const;
+    const Pointer& at(uint index) const;
+    const Block& block(uint index) const;
+
+public:         // Operations
+    Pointer& edit(uint index);
+    void reserve(uint count);
+    void append(const Pointer &node);
+    void insert(uint index, const Pointer &node);
+    void remove(uint index);
+
+protected:      // Implementation
+    void reflow(uint first, QVector<Pointer> &tail);
+
+protected:      // Data Members
+    QVector<Block> m_blocks;            /**< Blocks of children.            */
+    uint m_count;                       /**< Number of children.            */
+};
+
+/**
+ * @internal
+ * A node of a persistent tree.
+ * Nodes are never changed while shared. An edit copies the node and its
+ * ancestors only. The copies share the name, text, attributes and the other
+ * children with the original.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+struct SSXMLVersionNode : public QSharedData
+{
+    typedef QExplicitlySharedDataPointer<SSXMLVersionNode> Pointer;
+
+    QString name;                       /**< Element name.                  */
+    QString text;                       /**< Element text.                  */
+    QHash<QString, QString> attrs;      /**< Attributes.                    */
+    SSXMLVersionChildren nodes;         /**< Children.                      */
+};
+
+/**
+ * @ingroup ssqt_xml
+ * A read only reference to an element of a SSXMLVersion.
+ * The object holds a reference to the element, so it stays valid after the
+ * version it was taken from is changed or destroyed. It always shows the
+ * element as it was in that version. Its public interface mimics the read
+ * operations of \c SSXMLElement.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLVersionElement
+{
+public:
+    SSXMLVersionElement();
+    explicit SSXMLVersionElement(const SSXMLVersionNode::Pointer &node);
+
+public:         // Attributes
+    // bool isNull() const;/*{{{*/
+    /**
+     * Checks whether this object refers to an element.
+     * @since 1.1
+     **/
+    bool isNull() const;
+    /*}}}*/
+    // QString elementName() const;/*{{{*/
+    /**
+     * The element name.
+     * @since 1.1
+     **/
+    QString elementName() const;
+    /*}}}*/
+    // bool hasAttributes() const;/*{{{*/
+    /**
+     * Checks whether the element has attributes.
+     * @since 1.1
+     **/
+    bool hasAttributes() const;
+    /*}}}*/
+    // bool hasChildren() const;/*{{{*/
+    /**
+     * Checks whether the element has children.
+     * @since 1.1
+     **/
+    bool hasChildren() const;
+    /*}}}*/
+    // bool has(const QString &attrName) const;/*{{{*/
+    /**
+     * Checks whether the element has an attribute.
+     * @param attrName Name of the attribute.
+     * @since 1.1
+     **/
+    bool has(const QString &attrName) const;
+    /*}}}*/
+    // size_t numberOfAttributes() const;/*{{{*/
+    /**
+     * Number of attributes of the element.
+     * @since 1.1
+     **/
+    size_t numberOfAttributes() const;
+    /*}}}*/
+    // size_t numberOfChildren() const;/*{{{*/
+    /**
+     * Number of children of the element.
+     * @since 1.1
+     **/
+    size_t numberOfChildren() const;
+    /*}}}*/
+    // QString text() const;/*{{{*/
+    /**
+     * The element text.
+     * @since 1.1
+     **/
+    QString text() const;
+    /*}}}*/
+    // const QHash<QString, QString>& attributes() const;/*{{{*/
+    /**
+     * All attributes of the element.
+     * @returns A reference valid while this object is alive.
+     * @since 1.1
+     **/
+    const QHash<QString, QString>& attributes() const;
+    /*}}}*/
+    // QString attribute(const QString &attrName) const;/*{{{*/
+    /**
+     * The value of an attribute.
+     * @param attrName Name of the attribute.
+     * @returns The value or an empty string when the attribute doesn't exist.
+     * @since 1.1
+     **/
+    QString attribute(const QString &attrName) const;
+    /*}}}*/
+
+public:         // Child Elements
+    // SSXMLVersionElement elementAt(uint index) const;/*{{{*/
+    /**
+     * Gets a child element.
+     * @param index Zero based index of the child.
+     * @returns The child or a \e null object when \a index is invalid.
+     * @since 1.1
+     **/
+    SSXMLVersionElement elementAt(uint index) const;
+    /*}}}*/
+    // SSXMLVersionElement firstElement() const;/*{{{*/
+    /**
+     * Gets the first child element.
+     * @returns The child or a \e null object when there is none.
+     * @since 1.1
+     **/
+    SSXMLVersionElement firstElement() const;
+    /*}}}*/
+    // SSXMLVersionElement lastElement() const;/*{{{*/
+    /**
+     * Gets the last child element.
+     * @returns The child or a \e null object when there is none.
+     * @since 1.1
+     **/
+    SSXMLVersionElement lastElement() const;
+    /*}}}*/
+
+public:         // Operators
+    // bool operator ==(const SSXMLVersionElement &other) const;/*{{{*/
+    /**
+     * Checks whether two objects refer to the same element.
+     * @param other The other object.
+     * @returns \b true when both objects refer to the same node. Elements not
+     * changed between two versions are the same node in both.
+     * @since 1.1
+     **/
+    bool operator ==(const SSXMLVersionElement &other) const;
+    /*}}}*/
+    // QString operator[](const QString &attrName) const;/*{{{*/
+    /**
+     * The same as #attribute().
+     * @since 1.1
+     **/
+    QString operator[](const QString &attrName) const;
+    /*}}}*/
+
+protected:      // Data Members
+    SSXMLVersionNode::Pointer m_node;   /**< The element.                   */
+
+    friend class SSXMLVersion;
+};
+
+/**
+ * @ingroup ssqt_xml
+ * A persistent version of an element tree.
+ * The tree nodes are shared among versions. Copying a version copies a single
+ * pointer, so taking a snapshot costs O(1). Changing a version copies only
+ * the changed element and its ancestors. All other elements stay shared with
+ * the versions copied before. Restoring a snapshot is an assignment.
+ *
+ * Elements are addressed by their path: the index of the element and of each
+ * of its ancestors, starting at the child of the root. An empty path is the
+ * root. This is the same path kept by SSXMLChange.
+ *
+ * Building a version from an element tree, with #assign(), copies the whole
+ * tree. So does #extract(SSXMLElement*). An editor that works on a
+ * SSXMLDocument should build the version once and then keep it in sync with
+ * #apply(), called from SSXMLJournal::recorded(). Restoring a snapshot in the
+ * document is done with #extract(SSXMLElement*, const SSXMLVersion&), that
+ * changes only the elements that differ between the two versions:
+ * ~~~~~~~~~~~~~~{.cpp}
+ * class Editor : public SSXMLJournal
+ * {
+ * public:
+ *     SSXMLVersion current;
+ * protected:
+ *     void recorded(const SSXMLChange &change) { current.apply(change); }
+ * };
+ *
+ * Editor editor;
+ * QList<SSXMLVersion> undo;
+ *
+ * editor.current.assign(&document);
+ * document.journal(&editor);
+ *
+ * undo.append(editor.current);                 // Snapshot.
+ * document.elementAt(2)->elementAt(0)->set("name", "new");
+ *
+ * SSXMLVersion previous = undo.takeLast();     // Undo.
+ * editor.pause(true);
+ * previous.extract(&document, editor.current);
+ * editor.pause(false);
+ * editor.current = previous;
+ * ~~~~~~~~~~~~~~
+ * @remarks The cost of an edit is the depth of the element times the number
+ * of blocks of children of its ancestors plus \c SSXML_VERSION_BLOCK, since
+ * the list of blocks and one block are copied in each ancestor. The strings
+ * and attribute hashes are implicitly shared.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLVersion
+{
+public:
+    SSXMLVersion();
+    explicit SSXMLVersion(const SSXMLElement *root);
+
+public:         // Attributes
+    // bool isEmpty() const;/*{{{*/
+    /**
+     * Checks whether this version has no elements.
+     * @since 1.1
+     **/
+    bool isEmpty() const;
+    /*}}}*/
+    // SSXMLVersionElement documentElement() const;/*{{{*/
+    /**
+     * The root element.
+     * @returns The root or a \e null object when the version is empty.
+     * @since 1.1
+     **/
+    SSXMLVersionElement documentElement() const;
+    /*}}}*/
+    // SSXMLVersionElement element(const QVector<int> &path) const;/*{{{*/
+    /**
+     * Finds an element by its path.
+     * @param path Path of the element.
+     * @returns The element or a \e null object when the path doesn't exist.
+     * @since 1.1
+     **/
+    SSXMLVersionElement element(const QVector<int> &path) const;
+    /*}}}*/
+    // size_t sharedWith(const SSXMLVersion &other) const;/*{{{*/
+    /**
+     * Counts the elements shared with another version.
+     * @param other The other version.
+     * @returns The number of elements of this version that are also in \a
+     * other. Useful to measure the memory saved by sharing.
+     * @since 1.1
+     **/
+    size_t sharedWith(const SSXMLVersion &other) const;
+    /*}}}*/
+
+public:         // Operations
+    // void assign(const SSXMLElement *root);/*{{{*/
+    /**
+     * Builds this version from an element tree.
+     * @param root The root element. It and all its descendants are copied.
+     * \b NULL empties the version.
+     * @since 1.1
+     **/
+    void assign(const SSXMLElement *root);
+    /*}}}*/
+    // void extract(SSXMLElement *root) const;/*{{{*/
+    /**
+     * Copies this version to an element tree.
+     * @param root Element that receives the root of this version. Its
+     * current attributes, text and children are replaced.
+     * @since 1.1
+     **/
+    void extract(SSXMLElement *root) const;
+    /*}}}*/
+    // void extract(SSXMLElement *root, const SSXMLVersion &current) const;/*{{{*/
+    /**
+     * Changes an element tree to hold this version.
+     * Only the elements that differ between this version and \a current are
+     * changed. The elements shared by both versions are skipped without
+     * being visited, so the cost depends on the size of the difference, not
+     * on the size of the tree.
+     * @param root Element that holds \a current. Usually the tree \a current
+     * was built from and kept in sync with #apply().
+     * @param current The version held by \a root. When \a root doesn't
+     * match it, the mismatched children are copied again.
+     * @since 1.1
+     **/
+    void extract(SSXMLElement *root, const SSXMLVersion &current) const;
+    /*}}}*/
+    // bool apply(const SSXMLChange &change);/*{{{*/
+    /**
+     * Applies a change recorded by a SSXMLJournal.
+     * The change is applied by path, so this version must hold the same tree
+     * the document held before the change.
+     * @param change The change. It must be applied from
+     * SSXMLJournal::recorded(), while SSXMLChange::element is valid. Added
+     * children are copied with their subtree.
+     * @returns \b false when the path of the change doesn't exist.
+     * @since 1.1
+     **/
+    bool apply(const SSXMLChange &change);
+    /*}}}*/
+    // void clear();/*{{{*/
+    /**
+     * Empties this version.
+     * @since 1.1
+     **/
+    void clear();
+    /*}}}*/
+    // bool set(const QVector<int> &path, const QString &attrName, const QString &attrValue);/*{{{*/
+    /**
+     * Adds or changes an attribute.
+     * @param path Path of the element.
+     * @param attrName Name of the attribute.
+     * @param attrValue Value of the attribute.
+     * @returns \b false when \a path doesn't exist.
+     * @since 1.1
+     **/
+    bool set(const QVector<int> &path, const QString &attrName, const QString &attrValue);
+    /*}}}*/
+    // bool remove(const QVector<int> &path, const QString &attrName);/*{{{*/
+    /**
+     * Removes an attribute.
+     * @param path Path of the element.
+     * @param attrName Name of the attribute.
+     * @returns \b false when \a path doesn't exist.
+     * @since 1.1
+     **/
+    bool remove(const QVector<int> &path, const QString &attrName);
+    /*}}}*/
+    // bool rename(const QVector<int> &path, const QString &name);/*{{{*/
+    /**
+     * Changes the name of an element.
+     * @param path Path of the element.
+     * @param name The new name.
+     * @returns \b false when \a path doesn't exist.
+     * @since 1.1
+     **/
+    bool rename(const QVector<int> &path, const QString &name);
+    /*}}}*/
+    // bool text(const QVector<int> &path, const QString &elementText);/*{{{*/
+    /**
+     * Changes the text of an element.
+     * @param path Path of the element.
+     * @param elementText The new text.
+     * @returns \b false when \a path doesn't exist or the element has
+     * children. Like SSXMLElement::text(), children have priority.
+     * @since 1.1
+     **/
+    bool text(const QVector<int> &path, const QString &elementText);
+    /*}}}*/
+    // bool insert(const QVector<int> &path, uint index, const SSXMLElement *element);/*{{{*/
+    /**
+     * Inserts a copy of an element tree.
+     * @param path Path of the parent element.
+     * @param index Position of the new child. Values past the last child
+     * append it.
+     * @param element The element to copy, with its subtree.
+     * @returns \b false when \a path doesn't exist or \a element is \b NULL.
+     * @since 1.1
+     **/
+    bool insert(const QVector<int> &path, uint index, const SSXMLElement *element);
+    /*}}}*/
+    // bool insert(const QVector<int> &path, uint index, const SSXMLVersionElement &element);/*{{{*/
+    /**
+     * Inserts an element of any version.
+     * @param path Path of the parent element.
+     * @param index Position of the new child. Values past the last child
+     * append it.
+     * @param element The element to insert. Nothing is copied. The subtree
+     * is shared with the version it comes from.
+     * @returns \b false when \a path doesn't exist or \a element is \e null.
+     * @since 1.1
+     **/
+    bool insert(const QVector<int> &path, uint index, const SSXMLVersionElement &element);
+    /*}}}*/
+    // bool remove(const QVector<int> &path);/*{{{*/
+    /**
+     * Removes an element with its subtree.
+     * @param path Path of the element. Must not be empty.
+     * @returns \b false when \a path is empty or doesn't exist.
+     * @since 1.1
+     **/
+    bool remove(const QVector<int> &path);
+    /*}}}*/
+
+public:         // Operators
+    // bool operator ==(const SSXMLVersion &other) const;/*{{{*/
+    /**
+     * Checks whether two versions are the same.
+     * @returns \b true when both versions share the same root. Versions with
+     * equal content built separately are not the same.
+     * @since 1.1
+     **/
+    bool operator ==(const SSXMLVersion &other) const;
+    /*}}}*/
+
+protected:      // Implementation
+    SSXMLVersionNode* edit(const QVector<int> &path);
+
+protected:      // Data Members
+    SSXMLVersionNode::Pointer m_root;   /**< Root element.                  */
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLVersionChildren *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLVersionChildren::SSXMLVersionChildren();/*{{{*/
+inline SSXMLVersionChildren::SSXMLVersionChildren() : m_count(0) { }
+/*}}}*/
+// inline size_t SSXMLVersionChildren::count() const;/*{{{*/
+inline size_t SSXMLVersionChildren::count() const {
+    return m_count;
+}
+/*}}}*/
+// inline size_t SSXMLVersionChildren::countBlocks() const;/*{{{*/
+inline size_t SSXMLVersionChildren::countBlocks() const {
+    return m_blocks.count();
+}
+/*}}}*/
+// inline const SSXMLVersionChildren::Pointer& SSXMLVersionChildren::at(uint index) const;/*{{{*/
+inline const SSXMLVersionChildren::Pointer& SSXMLVersionChildren::at(uint index) const {
+    return m_blocks.at(index / SSXML_VERSION_BLOCK)->nodes.at(index % SSXML_VERSION_BLOCK);
+}
+/*}}}*/
+// inline const SSXMLVersionChildren::Block& SSXMLVersionChildren::block(uint index) const;/*{{{*/
+inline const SSXMLVersionChildren::Block& SSXMLVersionChildren::block(uint index) const {
+    return m_blocks.at(index);
+}
+/*}}}*/
+///@} SSXMLVersionChildren /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLVersionElement *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLVersionElement::SSXMLVersionElement();/*{{{*/
+/**
+ * Default constructor.
+ * Builds a \e null element.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLVersionElement::SSXMLVersionElement() { }
+/*}}}*/
+// inline SSXMLVersionElement::SSXMLVersionElement(const SSXMLVersionNode::Pointer &node);/*{{{*/
+/**
+ * Builds a reference to a node.
+ * @param node The node. Can be \b NULL.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLVersionElement::SSXMLVersionElement(const SSXMLVersionNode::Pointer &node) : m_node(node) { }
+/*}}}*/
+// inline bool SSXMLVersionElement::isNull() const;/*{{{*/
+inline bool SSXMLVersionElement::isNull() const {
+    return !m_node;
+}
+/*}}}*/
+// inline QString SSXMLVersionElement::elementName() const;/*{{{*/
+inline QString SSXMLVersionElement::elementName() const {
+    return (m_node ? m_node->name : QString());
+}
+/*}}}*/
+// inline bool SSXMLVersionElement::hasAttributes() const;/*{{{*/
+inline bool SSXMLVersionElement::hasAttributes() const {
+    return (numberOfAttributes() > 0);
+}
+/*}}}*/
+// inline bool SSXMLVersionElement::hasChildren() const;/*{{{*/
+inline bool SSXMLVersionElement::hasChildren() const {
+    return (numberOfChildren() > 0);
+}
+/*}}}*/
+// inline bool SSXMLVersionElement::has(const QString &attrName) const;/*{{{*/
+inline bool SSXMLVersionElement::has(const QString &attrName) const {
+    return (m_node && m_node->attrs.contains(attrName));
+}
+/*}}}*/
+// inline size_t SSXMLVersionElement::numberOfAttributes() const;/*{{{*/
+inline size_t SSXMLVersionElement::numberOfAttributes() const {
+    return (m_node ? m_node->attrs.count() : 0);
+}
+/*}}}*/
+// inline size_t SSXMLVersionElement::numberOfChildren() const;/*{{{*/
+inline size_t SSXMLVersionElement::numberOfChildren() const {
+    return (m_node ? m_node->nodes.count() : 0);
+}
+/*}}}*/
+// inline QString SSXMLVersionElement::text() const;/*{{{*/
+inline QString SSXMLVersionElement::text() const {
+    return (m_node ? m_node->text : QString());
+}
+/*}}}*/
+// inline const QHash<QString, QString>& SSXMLVersionElement::attributes() const;/*{{{*/
+inline const QHash<QString, QString>& SSXMLVersionElement::attributes() const {
+    static const QHash<QString, QString> empty;
+    return (m_node ? m_node->attrs : empty);
+}
+/*}}}*/
+// inline QString SSXMLVersionElement::attribute(const QString &attrName) const;/*{{{*/
+inline QString SSXMLVersionElement::attribute(const QString &attrName) const {
+    return (m_node ? m_node->attrs.value(attrName) : QString());
+}
+/*}}}*/
+// inline SSXMLVersionElement SSXMLVersionElement::elementAt(uint index) const;/*{{{*/
+inline SSXMLVersionElement SSXMLVersionElement::elementAt(uint index) const {
+    if (index >= numberOfChildren()) return SSXMLVersionElement();
+    return SSXMLVersionElement(m_node->nodes.at(index));
+}
+/*}}}*/
+// inline SSXMLVersionElement SSXMLVersionElement::firstElement() const;/*{{{*/
+inline SSXMLVersionElement SSXMLVersionElement::firstElement() const {
+    return elementAt(0);
+}
+/*}}}*/
+// inline SSXMLVersionElement SSXMLVersionElement::lastElement() const;/*{{{*/
+inline SSXMLVersionElement SSXMLVersionElement::lastElement() const {
+    return elementAt((uint)numberOfChildren() - 1);
+}
+/*}}}*/
+// inline bool SSXMLVersionElement::operator ==(const SSXMLVersionElement &other) const;/*{{{*/
+inline bool SSXMLVersionElement::operator ==(const SSXMLVersionElement &other) const {
+    return (m_node == other.m_node);
+}
+/*}}}*/
+// inline QString SSXMLVersionElement::operator[](const QString &attrName) const;/*{{{*/
+inline QString SSXMLVersionElement::operator[](const QString &attrName) const {
+    return attribute(attrName);
+}
+/*}}}*/
+///@} SSXMLVersionElement /*}}}*/
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLVersion *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline SSXMLVersion::SSXMLVersion();/*{{{*/
+/**
+ * Default constructor.
+ * Builds an empty version.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLVersion::SSXMLVersion() { }
+/*}}}*/
+// inline SSXMLVersion::SSXMLVersion(const SSXMLElement *root);/*{{{*/
+/**
+ * Builds a version from an element tree.
+ * @param root The root element. See #assign().
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+inline SSXMLVersion::SSXMLVersion(const SSXMLElement *root) {
+    assign(root);
+}
+/*}}}*/
+// inline bool SSXMLVersion::isEmpty() const;/*{{{*/
+inline bool SSXMLVersion::isEmpty() const {
+    return !m_root;
+}
+/*}}}*/
+// inline SSXMLVersionElement SSXMLVersion::documentElement() const;/*{{{*/
+inline SSXMLVersionElement SSXMLVersion::documentElement() const {
+    return SSXMLVersionElement(m_root);
+}
+/*}}}*/
+// inline void SSXMLVersion::clear();/*{{{*/
+inline void SSXMLVersion::clear() {
+    m_root.reset();
+}
+/*}}}*/
+// inline bool SSXMLVersion::operator ==(const SSXMLVersion &other) const;/*{{{*/
+inline bool SSXMLVersion::operator ==(const SSXMLVersion &other) const {
+    return (m_root == other.m_root);
+}
+/*}}}*/
+///@} SSXMLVersion /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLV_HPP_DEFINED__ */
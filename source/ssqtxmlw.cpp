@@ -0,0 +1,257 @@
+/**
+ * \file
+ * Defines the SSXMLWriter class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlw.hpp"
+
+/* ===========================================================================
+ * SSXMLWriter class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Constructors & Destructor */ //@{
+/* ------------------------------------------------------------------------ */
+// SSXMLWriter::SSXMLWriter(QIODevice *device = NULL, uint width = 0);/*{{{*/
+SSXMLWriter::SSXMLWriter(QIODevice *device, uint width) : m_width(width),
+    m_error(SSNO_ERROR), m_open(false), m_children(false), m_root(false)
+{
+    m_stream.setCodec(SSENC_UTF8);
+    if (device) m_stream.setDevice(device);
+
+    m_buffer.reserve(SSXML_PRINT_BLOCK + SSXML_PRINT_BLOCK / 4);
+}
+/*}}}*/
+// SSXMLWriter::~SSXMLWriter();/*{{{*/
+SSXMLWriter::~SSXMLWriter()
+{
+    flush();
+}
+/*}}}*/
+///@} Constructors & Destructor
+
+/* ------------------------------------------------------------------------ */
+/*! \name Operations */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLWriter::setDevice(QIODevice *device);/*{{{*/
+void SSXMLWriter::setDevice(QIODevice *device)
+{
+    flush();
+
+    m_stream.setDevice(device);
+    m_names.clear();
+
+    m_error    = SSNO_ERROR;
+    m_open     = false;
+    m_children = false;
+    m_root     = false;
+}
+/*}}}*/
+// SSXMLWriter& SSXMLWriter::startDocument();/*{{{*/
+SSXMLWriter& SSXMLWriter::startDocument()
+{
+    ssassert(!m_root, "SSXMLWriter: the XML declaration must be the first output.");
+
+    m_buffer.append(QLatin1String("<?xml version=\"1.0\" encoding=\"" SSENC_UTF8 "\" ?>"));
+    if (m_width > 0) m_buffer.append('\n');
+
+    return *this;
+}
+/*}}}*/
+// SSXMLWriter& SSXMLWriter::startElement(const QString &name);/*{{{*/
+SSXMLWriter& SSXMLWriter::startElement(const QString &name)
+{
+    ssassert(!name.isEmpty(), "SSXMLWriter: element without name.");
+    ssassert(!m_names.isEmpty() || !m_root, "SSXMLWriter: second root element.");
+
+    closeTag();
+    if (!m_names.isEmpty()) indent(m_names.count());
+
+    m_buffer.append('<').append(name);
+    m_names.append(name);
+
+    m_open     = true;
+    m_children = false;
+    m_root     = true;
+
+    return *this;
+}
+/*}}}*/
+// SSXMLWriter& SSXMLWriter::attribute(const QString &name, const QString &value);/*{{{*/
+SSXMLWriter& SSXMLWriter::attribute(const QString &name, const QString &value)
+{
+    ssassert(m_open, "SSXMLWriter: attribute outside of a start tag.");
+
+    m_buffer.append(' ').append(name).append(QLatin1String("=\""));
+    SSXMLElement::escape(m_buffer, value, true);
+    m_buffer.append('"');
+
+    return *this;
+}
+/*}}}*/
+// SSXMLWriter& SSXMLWriter::text(const QString &value);/*{{{*/
+SSXMLWriter& SSXMLWriter::text(const QString &value)
+{
+    ssassert(!m_names.isEmpty(), "SSXMLWriter: text outside of the root element.");
+
+    if (value.isEmpty()) return *this;
+
+    closeTag();
+    SSXMLElement::escape(m_buffer, value, false);
+    checkBuffer();
+
+    return *this;
+}
+/*}}}*/
+// SSXMLWriter& SSXMLWriter::element(const SSXMLElement *element);/*{{{*/
+SSXMLWriter& SSXMLWriter::element(const SSXMLElement *element)
+{
+    ssassert(element != NULL, "SSXMLWriter: NULL element.");
+    ssassert(!m_names.isEmpty() || !m_root, "SSXMLWriter: second root element.");
+
+    if (!element) return *this;
+
+    closeTag();
+
+    if (m_width == 0)
+        element->print(m_buffer, &m_stream, 0, 0, SSXML_COMPACT);
+    else
+    {
+        /* SSXMLElement::print() starts with the indentation and ends with a
+         * line break. */
+        if (!m_names.isEmpty()) m_buffer.append('\n');
+        element->print(m_buffer, &m_stream, m_names.count(), m_width, 0);
+        m_buffer.chop(1);
+    }
+
+    m_children = true;
+    m_root     = true;
+    checkBuffer();
+
+    return *this;
+}
+/*}}}*/
+// SSXMLWriter& SSXMLWriter::endElement();/*{{{*/
+SSXMLWriter& SSXMLWriter::endElement()
+{
+    ssassert(!m_names.isEmpty(), "SSXMLWriter: endElement() without startElement().");
+
+    if (m_names.isEmpty()) return *this;
+
+    if (m_open)
+    {
+        m_buffer.append(QLatin1String("/>"));
+        m_open = false;
+    }
+    else
+    {
+        if (m_children) indent(m_names.count() - 1);
+        m_buffer.append(QLatin1String("</")).append(m_names.last()).append('>');
+    }
+
+    m_names.removeLast();
+    m_children = true;          /* The parent has at least this child. */
+
+    if (m_names.isEmpty() && (m_width > 0))
+        m_buffer.append('\n');
+
+    checkBuffer();
+    return *this;
+}
+/*}}}*/
+// error_t SSXMLWriter::endDocument();/*{{{*/
+error_t SSXMLWriter::endDocument()
+{
+    while (!m_names.isEmpty())
+        endElement();
+
+    return flush();
+}
+/*}}}*/
+// error_t SSXMLWriter::flush();/*{{{*/
+error_t SSXMLWriter::flush()
+{
+    if (!m_stream.device())
+        return m_error;
+
+    if (!m_buffer.isEmpty())
+    {
+        m_stream << m_buffer;
+        m_buffer.resize(0);
+    }
+    m_stream.flush();
+
+    if (m_stream.status() != QTextStream::Ok)
+        m_error = SSE_IO;
+
+    return m_error;
+}
+/*}}}*/
+///@} Operations
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLWriter::closeTag();/*{{{*/
+/**
+ * Ends the start tag of the current element, if it is still open.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLWriter::closeTag()
+{
+    if (!m_open) return;
+
+    m_buffer.append('>');
+    m_open = false;
+}
+/*}}}*/
+// void SSXMLWriter::indent(size_t level);/*{{{*/
+/**
+ * Starts a new line indented to a level.
+ * @param level Indentation level. Does nothing when the indentation width
+ * is zero.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLWriter::indent(size_t level)
+{
+    if (m_width == 0) return;
+
+    m_buffer.append('\n');
+    if (level > 0) m_buffer.append(QString((int)(level * m_width), ' '));
+}
+/*}}}*/
+// void SSXMLWriter::checkBuffer();/*{{{*/
+/**
+ * Passes the buffered text to the stream when it is larger than \c
+ * SSXML_PRINT_BLOCK characters.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLWriter::checkBuffer()
+{
+    if ((m_buffer.length() < SSXML_PRINT_BLOCK) || !m_stream.device())
+        return;
+
+    m_stream << m_buffer;
+    m_buffer.resize(0);             /* Keeps the allocated block. */
+
+    if (m_stream.status() != QTextStream::Ok)
+        m_error = SSE_IO;
+}
+/*}}}*/
+///@} Implementation
+
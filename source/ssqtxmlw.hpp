@@ -0,0 +1,243 @@
+/**
+ * \file
+ * Declares the SSXMLWriter class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLW_HPP_DEFINED__
+#define __SSQTXMLW_HPP_DEFINED__
+
+#include <QString>
+#include <QVector>
+#include <QIODevice>
+#include <QTextStream>
+#include "ssqtcmn.hpp"
+#include "ssqterr.hpp"
+#include "ssqtxmle.hpp"
+
+/**
+ * @ingroup ssqt_xml
+ * Writes a document without building an element tree.
+ * Elements are written as they are started and ended. The output is the same
+ * produced by SSXMLElement::print(): UTF-8 text, escaped the same way,
+ * accumulated in a buffer of \c SSXML_PRINT_BLOCK characters before being
+ * passed to the device. Memory usage doesn't depend on the size of the
+ * document, only on the nesting level.
+ *
+ * Nesting is checked in debug builds. Ending an element that was not started,
+ * adding attributes after the content of an element or starting a second
+ * root element stops the execution with \c ssassert().
+ * ~~~~~~~~~~~~~~{.cpp}
+ * SSXMLWriter writer(&file);
+ *
+ * writer.startDocument();
+ * writer.startElement("rows");
+ * for (int i = 0; i < count; ++i)
+ * {
+ *     writer.startElement("row").attribute("id", rows[i].id);
+ *     writer.text(rows[i].value).endElement();
+ * }
+ * error_t result = writer.endDocument();
+ * ~~~~~~~~~~~~~~
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLWriter
+{
+public:
+    // explicit SSXMLWriter(QIODevice *device = NULL, uint width = 0);/*{{{*/
+    /**
+     * Builds a writer.
+     * @param device The device to write. Must be open for writing. Can be \b
+     * NULL and set later with #setDevice().
+     * @param width Number of spaces in each indentation level. When zero the
+     * document is written without indentation nor line breaks.
+     * @since 1.1
+     **/
+    explicit SSXMLWriter(QIODevice *device = NULL, uint width = 0);
+    /*}}}*/
+    // virtual ~SSXMLWriter();/*{{{*/
+    /**
+     * Destructor.
+     * Passes the buffered text to the device. Open elements are not closed.
+     * @since 1.1
+     **/
+    virtual ~SSXMLWriter();
+    /*}}}*/
+
+public:         // Attributes
+    // QIODevice* device() const;/*{{{*/
+    /**
+     * The device being written.
+     * @since 1.1
+     **/
+    QIODevice* device() const;
+    /*}}}*/
+    // size_t depth() const;/*{{{*/
+    /**
+     * Number of elements started and not yet ended.
+     * @since 1.1
+     **/
+    size_t depth() const;
+    /*}}}*/
+    // error_t error() const;/*{{{*/
+    /**
+     * The result of the writes passed to the device.
+     * @return \b 0 (\c SSNO_ERROR) when there is no error. \b SSE_IO when the
+     * device failed.
+     * @since 1.1
+     **/
+    error_t error() const;
+    /*}}}*/
+
+public:         // Operations
+    // void setDevice(QIODevice *device);/*{{{*/
+    /**
+     * Starts writing to another device.
+     * @param device The device to write. Must be open for writing.
+     * @remarks The buffered text is passed to the current device first. The
+     * state of open elements is discarded.
+     * @since 1.1
+     **/
+    void setDevice(QIODevice *device);
+    /*}}}*/
+    // SSXMLWriter& startDocument();/*{{{*/
+    /**
+     * Writes the XML declaration.
+     * @returns This writer.
+     * @remarks Optional. When used must be the first call.
+     * @since 1.1
+     **/
+    SSXMLWriter& startDocument();
+    /*}}}*/
+    // SSXMLWriter& startElement(const QString &name);/*{{{*/
+    /**
+     * Writes the start tag of an element.
+     * @param name The element name. Cannot be empty.
+     * @returns This writer.
+     * @remarks The tag is kept open until the first content of the element
+     * is written, so #attribute() can be called.
+     * @since 1.1
+     **/
+    SSXMLWriter& startElement(const QString &name);
+    /*}}}*/
+    // SSXMLWriter& attribute(const QString &name, const QString &value);/*{{{*/
+    /**
+     * Writes an attribute of the element just started.
+     * @param name The attribute name.
+     * @param value The attribute value. Escaped as needed.
+     * @returns This writer.
+     * @since 1.1
+     **/
+    SSXMLWriter& attribute(const QString &name, const QString &value);
+    /*}}}*/
+    // SSXMLWriter& attribute(const QString &name, qint64 value);/*{{{*/
+    /**
+     * Writes a numeric attribute of the element just started.
+     * @param name The attribute name.
+     * @param value The attribute value.
+     * @returns This writer.
+     * @since 1.1
+     **/
+    SSXMLWriter& attribute(const QString &name, qint64 value);
+    /*}}}*/
+    // SSXMLWriter& text(const QString &value);/*{{{*/
+    /**
+     * Writes text in the current element.
+     * @param value The text. Escaped as needed.
+     * @returns This writer.
+     * @since 1.1
+     **/
+    SSXMLWriter& text(const QString &value);
+    /*}}}*/
+    // SSXMLWriter& element(const SSXMLElement *element);/*{{{*/
+    /**
+     * Writes a whole element tree in the current element.
+     * @param element The element to write with its descendants.
+     * @returns This writer.
+     * @remarks Useful to write records built in memory, one at a time, in
+     * a large document.
+     * @since 1.1
+     **/
+    SSXMLWriter& element(const SSXMLElement *element);
+    /*}}}*/
+    // SSXMLWriter& endElement();/*{{{*/
+    /**
+     * Writes the end tag of the current element.
+     * @returns This writer.
+     * @remarks Elements without content are written as empty tags.
+     * @since 1.1
+     **/
+    SSXMLWriter& endElement();
+    /*}}}*/
+    // error_t endDocument();/*{{{*/
+    /**
+     * Ends all open elements and passes the buffered text to the device.
+     * @returns The same of #error().
+     * @since 1.1
+     **/
+    error_t endDocument();
+    /*}}}*/
+    // error_t flush();/*{{{*/
+    /**
+     * Passes the buffered text to the device.
+     * @returns The same of #error().
+     * @since 1.1
+     **/
+    error_t flush();
+    /*}}}*/
+
+protected:      // Implementation
+    void closeTag();
+    void indent(size_t level);
+    void checkBuffer();
+
+protected:      // Data Members
+    QTextStream m_stream;               /**< UTF-8 stream over the device.  */
+    QString m_buffer;                   /**< Text not yet in the stream.    */
+    QVector<QString> m_names;           /**< Names of the open elements.    */
+    uint    m_width;                    /**< Indentation width.             */
+    error_t m_error;                    /**< Result of writes.              */
+    bool    m_open;                     /**< Start tag waiting for '>'.     */
+    bool    m_children;                 /**< Current element has children.  */
+    bool    m_root;                     /**< Root element was written.      */
+
+private:
+    Q_DISABLE_COPY(SSXMLWriter)
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLWriter *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// inline QIODevice* SSXMLWriter::device() const;/*{{{*/
+inline QIODevice* SSXMLWriter::device() const {
+    return m_stream.device();
+}
+/*}}}*/
+// inline size_t SSXMLWriter::depth() const;/*{{{*/
+inline size_t SSXMLWriter::depth() const {
+    return m_names.count();
+}
+/*}}}*/
+// inline error_t SSXMLWriter::error() const;/*{{{*/
+inline error_t SSXMLWriter::error() const {
+    return m_error;
+}
+/*}}}*/
+// inline SSXMLWriter& SSXMLWriter::attribute(const QString &name, qint64 value);/*{{{*/
+inline SSXMLWriter& SSXMLWriter::attribute(const QString &name, qint64 value) {
+    return attribute(name, QString::number(value));
+}
+/*}}}*/
+///@} SSXMLWriter /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLW_HPP_DEFINED__ */
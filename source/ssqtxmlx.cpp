@@ -0,0 +1,244 @@
+/**
+ * \file
+ * Defines the SSXMLParallel class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#include "stdplx.hpp"
+#include "ssqtcmn.hpp"
+#include "ssqtdbg.hpp"
+#include "ssqtxmle.hpp"
+#include "ssqtxmlx.hpp"
+
+/* ---------------------------------------------------------------------------
+ * Internal Functions
+ * ------------------------------------------------------------------------ */
+// static size_t __xml_sizeUpTo(const SSXMLElement *element, size_t limit);/*{{{*/
+/**
+ * Counts the elements of a subtree, stopping past a limit.
+ * @param element The root of the subtree.
+ * @param limit The limit.
+ * @returns The number of elements in the subtree when it is not greater than
+ * \a limit. Otherwise any value greater than \a limit.
+ * @since 1.1
+ **/
+static size_t __xml_sizeUpTo(const SSXMLElement *element, size_t limit);
+/*}}}*/
+// static void __xml_visit(SSXMLElement *element, void (*visitor)(SSXMLElement*, void*, int), void *context, int task);/*{{{*/
+/**
+ * Visits a subtree in document order.
+ * @param element The root of the subtree.
+ * @param visitor Function called for each element.
+ * @param context Passed to \a visitor.
+ * @param task Index of the task, passed to \a visitor.
+ * @since 1.1
+ **/
+static void __xml_visit(SSXMLElement *element, void (*visitor)(SSXMLElement*, void*, int), void *context, int task);
+/*}}}*/
+
+/* ===========================================================================
+ * SSXMLParallelTask class
+ * ======================================================================== */
+
+/**
+ * @internal
+ * Runnable that takes tasks of a plan until there are none left.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLParallelTask : public QRunnable
+{
+public:
+    struct State
+    {
+        const SSXMLParallel::Plan *plan;    /**< Tasks to run.              */
+        SSXMLParallel::Visitor visitor;     /**< Called for each element.   */
+        void *context;                      /**< Passed to the visitor.     */
+        QAtomicInt next;                    /**< Next task to take.         */
+        QSemaphore finished;                /**< Released by each helper.   */
+    };
+
+    SSXMLParallelTask(State *state) : m_state(state) { }
+
+    void run() {
+        take(m_state);
+        m_state->finished.release();
+    }
+
+    static void take(State *state) {
+        int limit = state->plan->tasks.count();
+        int task;
+
+        while ((task = state->next.fetchAndAddOrdered(1)) < limit)
+            SSXMLParallel::work(*state->plan, task, state->visitor, state->context);
+    }
+
+protected:
+    State *m_state;
+};
+
+/* ===========================================================================
+ * SSXMLParallel class
+ * ======================================================================== */
+
+/* ------------------------------------------------------------------------ */
+/*! \name Implementation */ //@{
+/* ------------------------------------------------------------------------ */
+// void SSXMLParallel::plan(const SSXMLElement *root, size_t grain, Plan *plan);/*{{{*/
+/**
+ * Splits a tree in tasks.
+ * @param root The root of the tree.
+ * @param grain Number of elements in each task. Zero is the same as one.
+ * @param plan Receives the chunks of the tree and the tasks.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLParallel::plan(const SSXMLElement *root, size_t grain, Plan *plan)
+{
+    if (grain == 0) grain = 1;
+
+    plan->chunks.clear();
+    plan->tasks.clear();
+
+    split(const_cast<SSXMLElement*>(root), grain, plan);
+
+    /* Consecutive chunks are grouped until they have 'grain' elements. */
+    size_t limit = plan->chunks.count();
+    size_t size  = grain;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        if (size >= grain)
+        {
+            plan->tasks.append((int)i);
+            size = 0;
+        }
+        size += plan->chunks.at(i).size;
+    }
+}
+/*}}}*/
+// void SSXMLParallel::run(const Plan &plan, Visitor visitor, void *context);/*{{{*/
+/**
+ * Runs all the tasks of a plan.
+ * @param plan The plan.
+ * @param visitor Function called for each element.
+ * @param context Passed to \a visitor.
+ * @remarks The calling thread runs tasks too. Helpers are started only in
+ * idle threads of the global pool, so a call from a thread of the pool
+ * never waits for a thread that can't start.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLParallel::run(const Plan &plan, Visitor visitor, void *context)
+{
+    int tasks = plan.tasks.count();
+
+    if (tasks <= 1)
+    {
+        if (tasks == 1) work(plan, 0, visitor, context);
+        return;
+    }
+
+    SSXMLParallelTask::State state;
+    QThreadPool *pool = QThreadPool::globalInstance();
+    int helpers = 0;
+
+    state.plan    = &plan;
+    state.visitor = visitor;
+    state.context = context;
+    state.next.store(0);
+
+    while ((helpers < (tasks - 1)) && pool->tryStart(new SSXMLParallelTask(&state)))
+        helpers++;
+
+    SSXMLParallelTask::take(&state);
+    state.finished.acquire(helpers);
+}
+/*}}}*/
+// void SSXMLParallel::work(const Plan &plan, int task, Visitor visitor, void *context);/*{{{*/
+/**
+ * Runs one task.
+ * @param plan The plan.
+ * @param task Index of the task.
+ * @param visitor Function called for each element.
+ * @param context Passed to \a visitor.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLParallel::work(const Plan &plan, int task, Visitor visitor, void *context)
+{
+    int first = plan.tasks.at(task);
+    int last  = (((task + 1) < plan.tasks.count()) ? plan.tasks.at(task + 1) : plan.chunks.count());
+
+    for (int i = first; i < last; ++i)
+    {
+        const Chunk &chunk = plan.chunks.at(i);
+
+        if (chunk.subtree)
+            __xml_visit(chunk.element, visitor, context, task);
+        else
+            visitor(chunk.element, context, task);
+    }
+}
+/*}}}*/
+// void SSXMLParallel::split(SSXMLElement *element, size_t grain, Plan *plan);/*{{{*/
+/**
+ * Splits a subtree in chunks.
+ * @param element The root of the subtree.
+ * @param grain Maximum size of a subtree kept whole.
+ * @param plan Receives the chunks, in document order.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+void SSXMLParallel::split(SSXMLElement *element, size_t grain, Plan *plan)
+{
+    Chunk chunk;
+
+    chunk.element = element;
+    chunk.size    = __xml_sizeUpTo(element, grain);
+    chunk.subtree = (chunk.size <= grain);
+
+    if (chunk.subtree)
+    {
+        plan->chunks.append(chunk);
+        return;
+    }
+
+    /* Only the element itself. Its children are split in turn. */
+    chunk.size = 1;
+    plan->chunks.append(chunk);
+
+    size_t limit = element->numberOfChildren();
+    for (size_t i = 0; i < limit; ++i)
+        split(element->elementAt(i), grain, plan);
+}
+/*}}}*/
+///@} Implementation
+
+// static size_t __xml_sizeUpTo(const SSXMLElement *element, size_t limit);/*{{{*/
+static size_t __xml_sizeUpTo(const SSXMLElement *element, size_t limit)
+{
+    size_t count = element->numberOfChildren();
+    size_t size  = 1;
+
+    for (size_t i = 0; (i < count) && (size <= limit); ++i)
+        size += __xml_sizeUpTo(element->elementAt(i), limit - size);
+
+    return size;
+}
+/*}}}*/
+// static void __xml_visit(SSXMLElement *element, void (*visitor)(SSXMLElement*, void*, int), void *context, int task);/*{{{*/
+static void __xml_visit(SSXMLElement *element, void (*visitor)(SSXMLElement*, void*, int), void *context, int task)
+{
+    visitor(element, context, task);
+
+    size_t limit = element->numberOfChildren();
+    for (size_t i = 0; i < limit; ++i)
+        __xml_visit(element->elementAt(i), visitor, context, task);
+}
+/*}}}*/
+
@@ -0,0 +1,273 @@
+/**
+ * \file
+ * Declares the SSXMLParallel class.
+ *
+ * \author Alessandro Antonello <aantonello@paralaxe.com.br>
+ * \date   outubro 18, 2026
+ * \since  Super Simple for Qt 5 1.1
+ *
+ * \copyright
+ * This file is provided in hope that it will be useful to someone. It is
+ * offered in public domain. You may use, modify or distribute it freely.
+ *
+ * The code is provided "AS IS". There is no warranty at all, of any kind. You
+ * may change it if you like. Or just use it as it is.
+ */
+#ifndef __SSQTXMLX_HPP_DEFINED__
+#define __SSQTXMLX_HPP_DEFINED__
+
+#include <QList>
+#include <QVector>
+#include "ssqtcmn.hpp"
+#include "ssqtxmle.hpp"
+
+/**
+ * \ingroup ssqt_xml
+ * Default number of elements visited by each task of SSXMLParallel.
+ * @since 1.1
+ **/
+#define SSXML_PARALLEL_GRAIN    4096
+
+/**
+ * @ingroup ssqt_xml
+ * Algorithms run in parallel over an element tree.
+ * The tree is split in tasks of about \a grain elements each. Subtrees
+ * smaller than \a grain go whole to a single task. Larger subtrees are split
+ * among their children. The tasks are run by the threads of \c
+ * QThreadPool::globalInstance() and by the calling thread. Each thread takes
+ * the next task as soon as it finishes the previous one, so threads that get
+ * cheap tasks do more of them.
+ *
+ * Results are always in document order, whatever the number of threads or
+ * the order tasks finish. Trees smaller than \a grain are processed in the
+ * calling thread only.
+ * ~~~~~~~~~~~~~~{.cpp}
+ * struct Invalid {
+ *     bool operator()(const SSXMLElement *element) const {
+ *         return (element->elementName == "price") && (element->text().toDouble() < 0);
+ *     }
+ * };
+ *
+ * QList<SSXMLElement*> errors = SSXMLParallel::findAll(&document, Invalid());
+ * ~~~~~~~~~~~~~~
+ * @remarks Functions and predicates are called from several threads at the
+ * same time. They can read any element, but should change only the element
+ * they receive, and only its attributes and text. Change notifications must
+ * not be enabled in the tree (see SSXMLElement::watch()) while #forEach()
+ * runs.
+ * @since 1.1
+ *//* --------------------------------------------------------------------- */
+class SSXMLParallel
+{
+public:         // Algorithms
+    // template<typename Predicate> static QList<SSXMLElement*> findAll(const SSXMLElement *root, Predicate predicate, size_t grain = SSXML_PARALLEL_GRAIN);/*{{{*/
+    /**
+     * Finds the elements of a tree that satisfy a predicate.
+     * @param root The root of the tree. It is also tested.
+     * @param predicate Function or function object with the signature
+     * <tt>bool (const SSXMLElement*)</tt>.
+     * @param grain Number of elements in each task.
+     * @returns The elements for which \a predicate returned \b true, in
+     * document order.
+     * @since 1.1
+     **/
+    template<typename Predicate>
+    static QList<SSXMLElement*> findAll(const SSXMLElement *root, Predicate predicate, size_t grain = SSXML_PARALLEL_GRAIN);
+    /*}}}*/
+    // template<typename Predicate> static size_t countIf(const SSXMLElement *root, Predicate predicate, size_t grain = SSXML_PARALLEL_GRAIN);/*{{{*/
+    /**
+     * Counts the elements of a tree that satisfy a predicate.
+     * @param root The root of the tree. It is also tested.
+     * @param predicate Function or function object with the signature
+     * <tt>bool (const SSXMLElement*)</tt>.
+     * @param grain Number of elements in each task.
+     * @returns The number of elements for which \a predicate returned \b
+     * true.
+     * @since 1.1
+     **/
+    template<typename Predicate>
+    static size_t countIf(const SSXMLElement *root, Predicate predicate, size_t grain = SSXML_PARALLEL_GRAIN);
+    /*}}}*/
+    // template<typename Function> static void forEach(SSXMLElement *root, Function function, size_t grain = SSXML_PARALLEL_GRAIN);/*{{{*/
+    /**
+     * Calls a function for every element of a tree.
+     * @param root The root of the tree. It is also passed to \a function.
+     * @param function Function or function object with the signature
+     * <tt>void (SSXMLElement*)</tt>. It can change the attributes and text
+     * of the element it receives.
+     * @param grain Number of elements in each task.
+     * @since 1.1
+     **/
+    template<typename Function>
+    static void forEach(SSXMLElement *root, Function function, size_t grain = SSXML_PARALLEL_GRAIN);
+    /*}}}*/
+    // template<typename T, typename Function> static QVector<T> transform(const SSXMLElement *root, Function function, size_t grain = SSXML_PARALLEL_GRAIN);/*{{{*/
+    /**
+     * Maps every element of a tree to a value.
+     * @tparam T Type of the values.
+     * @param root The root of the tree. It is also mapped.
+     * @param function Function or function object with the signature
+     * <tt>T (const SSXMLElement*)</tt>.
+     * @param grain Number of elements in each task.
+     * @returns The values, one for each element, in document order.
+     * @since 1.1
+     **/
+    template<typename T, typename Function>
+    static QVector<T> transform(const SSXMLElement *root, Function function, size_t grain = SSXML_PARALLEL_GRAIN);
+    /*}}}*/
+
+protected:
+    typedef void (*Visitor)(SSXMLElement *element, void *context, int task);
+
+    struct Chunk
+    {
+        SSXMLElement *element;          /**< First element of the chunk.    */
+        size_t size;                    /**< Number of elements.            */
+        bool   subtree;                 /**< Whole subtree or element only. */
+    };
+
+    struct Plan
+    {
+        QVector<Chunk> chunks;          /**< Chunks in document order.      */
+        QVector<int>   tasks;           /**< First chunk of each task.      */
+    };
+
+    template<typename Predicate> struct FindAll
+    {
+        Predicate *predicate;
+        QList<SSXMLElement*> *results;
+
+        static void visit(SSXMLElement *element, void *context, int task) {
+            FindAll *job = static_cast<FindAll*>(context);
+            if ((*job->predicate)(element)) job->results[task].append(element);
+        }
+    };
+
+    template<typename Predicate> struct CountIf
+    {
+        Predicate *predicate;
+        size_t *results;
+
+        static void visit(SSXMLElement *element, void *context, int task) {
+            CountIf *job = static_cast<CountIf*>(context);
+            if ((*job->predicate)(element)) job->results[task]++;
+        }
+    };
+
+    template<typename Function> struct ForEach
+    {
+        Function *function;
+
+        static void visit(SSXMLElement *element, void *context, int task) {
+            Q_UNUSED(task);
+            (*static_cast<ForEach*>(context)->function)(element);
+        }
+    };
+
+    template<typename T, typename Function> struct Transform
+    {
+        Function *function;
+        QVector<T> *results;
+
+        static void visit(SSXMLElement *element, void *context, int task) {
+            Transform *job = static_cast<Transform*>(context);
+            job->results[task].append((*job->function)(element));
+        }
+    };
+
+protected:      // Implementation
+    static void plan(const SSXMLElement *root, size_t grain, Plan *plan);
+    static void run(const Plan &plan, Visitor visitor, void *context);
+    static void work(const Plan &plan, int task, Visitor visitor, void *context);
+    static void split(SSXMLElement *element, size_t grain, Plan *plan);
+
+    friend class SSXMLParallelTask;
+};
+/* Inline Functions {{{ */
+/* ------------------------------------------------------------------------ */
+/*! \name SSXMLParallel *//*{{{*/ //@{
+/* ------------------------------------------------------------------------ */
+// template<typename Predicate> QList<SSXMLElement*> SSXMLParallel::findAll(const SSXMLElement *root, Predicate predicate, size_t grain);/*{{{*/
+template<typename Predicate>
+QList<SSXMLElement*> SSXMLParallel::findAll(const SSXMLElement *root, Predicate predicate, size_t grain)
+{
+    QList<SSXMLElement*> found;
+    if (!root) return found;
+
+    Plan tasks;
+    plan(root, grain, &tasks);
+
+    QVector<QList<SSXMLElement*> > results(tasks.tasks.count());
+    FindAll<Predicate> job = { &predicate, results.data() };
+
+    run(tasks, &FindAll<Predicate>::visit, &job);
+
+    size_t limit = results.count();
+    for (size_t i = 0; i < limit; ++i)
+        found.append(results.at(i));
+
+    return found;
+}
+/*}}}*/
+// template<typename Predicate> size_t SSXMLParallel::countIf(const SSXMLElement *root, Predicate predicate, size_t grain);/*{{{*/
+template<typename Predicate>
+size_t SSXMLParallel::countIf(const SSXMLElement *root, Predicate predicate, size_t grain)
+{
+    if (!root) return 0;
+
+    Plan tasks;
+    plan(root, grain, &tasks);
+
+    QVector<size_t> results(tasks.tasks.count(), 0);
+    CountIf<Predicate> job = { &predicate, results.data() };
+
+    run(tasks, &CountIf<Predicate>::visit, &job);
+
+    size_t limit = results.count();
+    size_t count = 0;
+
+    for (size_t i = 0; i < limit; ++i)
+        count += results.at(i);
+
+    return count;
+}
+/*}}}*/
+// template<typename Function> void SSXMLParallel::forEach(SSXMLElement *root, Function function, size_t grain);/*{{{*/
+template<typename Function>
+void SSXMLParallel::forEach(SSXMLElement *root, Function function, size_t grain)
+{
+    if (!root) return;
+
+    Plan tasks;
+    plan(root, grain, &tasks);
+
+    ForEach<Function> job = { &function };
+    run(tasks, &ForEach<Function>::visit, &job);
+}
+/*}}}*/
+// template<typename T, typename Function> QVector<T> SSXMLParallel::transform(const SSXMLElement *root, Function function, size_t grain);/*{{{*/
+template<typename T, typename Function>
+QVector<T> SSXMLParallel::transform(const SSXMLElement *root, Function function, size_t grain)
+{
+    QVector<T> mapped;
+    if (!root) return mapped;
+
+    Plan tasks;
+    plan(root, grain, &tasks);
+
+    QVector<QVector<T> > results(tasks.tasks.count());
+    Transform<T, Function> job = { &function, results.data() };
+
+    run(tasks, &Transform<T, Function>::visit, &job);
+
+    size_t limit = results.count();
+    for (size_t i = 0; i < limit; ++i)
+        mapped += results.at(i);
+
+    return mapped;
+}
+/*}}}*/
+///@} SSXMLParallel /*}}}*/
+/* ------------------------------------------------------------------------ */
+/* }}} Inline Functions */
+#endif /* __SSQTXMLX_HPP_DEFINED__ */
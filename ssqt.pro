@@ -0,0 +1,12 @@
+# ============================================================================
+# Super Simple for Qt 5 Project File
+# Builds the library and the benchmarks of the XML layer.
+# ============================================================================
+TEMPLATE = subdirs
+
+SUBDIRS += library \
+    bench
+
+library.file  = source/ssqt.pro
+bench.file    = bench/ssqtbnch.pro
+bench.depends = library